@@ -0,0 +1,71 @@
+#pragma once
+#include "IDataGetter.hpp"
+
+#include <algorithm>
+#include <ranges>
+
+class ColumnBuilder {
+private:
+	struct Column {
+		std::string name;
+		std::size_t offset;
+		std::size_t count;
+	};
+
+public:
+	void Reserve(const std::size_t count) {
+		this->data_.reserve(count);
+	}
+
+	void BeginColumn(std::string name) {
+		this->columns_.push_back({ std::move(name), this->data_.size(), 0u });
+	}
+
+	void Push(const double value) {
+		this->data_.push_back(value);
+		++this->columns_.back().count;
+	}
+
+	[[nodiscard]] bool Contains(const std::string& name) const {
+		return this->Find(name) != nullptr;
+	}
+
+	void Build(const std::vector<std::string>& columnNames, AlignedBuffer& data, Eigen::Index& rows) {
+		auto maxCount = std::size_t{};
+		auto isInPlace = true;
+
+		for (auto j = 0u; j < columnNames.size(); ++j) {
+			maxCount = std::max(maxCount, this->Find(columnNames[j])->count);
+		}
+
+		for (auto j = 0u; j < columnNames.size(); ++j) {
+			const auto* column = this->Find(columnNames[j]);
+			isInPlace = isInPlace && column->count == maxCount && column->offset == j * maxCount;
+		}
+
+		rows = static_cast<Eigen::Index>(maxCount);
+
+		if (isInPlace && this->data_.size() == columnNames.size() * maxCount) {
+			data = std::move(this->data_);
+			return;
+		}
+
+		data.assign(columnNames.size() * maxCount, 0.0);
+
+		for (auto j = 0u; j < columnNames.size(); ++j) {
+			const auto* column = this->Find(columnNames[j]);
+			const auto begin = std::next(this->data_.begin(), column->offset);
+
+			std::copy(begin, std::next(begin, column->count), std::next(data.begin(), j * maxCount));
+		}
+	}
+
+private:
+	AlignedBuffer data_{};
+	std::vector<Column> columns_{};
+
+	[[nodiscard]] const Column* Find(const std::string& name) const {
+		const auto iter = std::ranges::find(this->columns_ | std::views::reverse, name, &Column::name);
+		return iter == std::ranges::end(this->columns_ | std::views::reverse) ? nullptr : &*iter;
+	}
+};
@@ -0,0 +1,134 @@
+#pragma once
+#include "IDataGetter.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+static_assert(std::endian::native == std::endian::little, "the columnar format stores little-endian doubles");
+
+class ColumnarFormat {
+public:
+	static constexpr auto* EXTENSION_STR = ".dmc";
+
+	static constexpr std::array<char, 8u> MAGIC{ 'D', 'M', 'L', '5', 'C', 'O', 'L', '\0' };
+	static constexpr std::uint32_t VERSION = 1u;
+	static constexpr std::uint32_t ALIGNMENT = 64u;
+
+	struct Header {
+		std::array<char, 8u> magic;
+		std::uint32_t version;
+		std::uint32_t columnCount;
+		std::uint64_t rowCount;
+		double freedom;
+		std::uint32_t alignment;
+		std::uint32_t reserved;
+		std::uint64_t dataOffset;
+	};
+
+	static_assert(sizeof(Header) == 48u);
+
+	ColumnarFormat() = delete;
+
+	static void Write(const std::string& path, const IDataGetter& dataGetter) {
+		const auto& columnNames = dataGetter.GetColumnNames();
+		const auto data = dataGetter.GetData();
+
+		auto namesSize = std::size_t{};
+		std::ranges::for_each(columnNames, [&namesSize](const auto& name) { namesSize += sizeof(std::uint32_t) + name.size(); });
+
+		Header header{};
+		header.magic = ColumnarFormat::MAGIC;
+		header.version = ColumnarFormat::VERSION;
+		header.columnCount = static_cast<std::uint32_t>(columnNames.size());
+		header.rowCount = static_cast<std::uint64_t>(dataGetter.GetRowCount());
+		header.freedom = dataGetter.GetFreedom();
+		header.alignment = ColumnarFormat::ALIGNMENT;
+		header.dataOffset = ColumnarFormat::AlignUp(sizeof(Header) + namesSize);
+
+		std::ofstream file(path, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+
+		if (!file.is_open()) {
+			throw std::runtime_error("ColumnarFormat: cannot create " + path);
+		}
+
+		file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+
+		std::ranges::for_each(columnNames, [&file](const auto& name) {
+			const auto length = static_cast<std::uint32_t>(name.size());
+			file.write(reinterpret_cast<const char*>(&length), sizeof(length));
+			file.write(name.data(), static_cast<std::streamsize>(name.size()));
+		});
+
+		const std::string padding(header.dataOffset - sizeof(Header) - namesSize, '\0');
+		file.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+		file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size_bytes()));
+
+		if (!file) {
+			throw std::runtime_error("ColumnarFormat: cannot write " + path);
+		}
+	}
+
+	[[nodiscard]] static Header ReadHeader(std::span<const std::byte> bytes) {
+		Header header{};
+
+		if (bytes.size() < sizeof(Header)) {
+			throw std::runtime_error("ColumnarFormat: truncated header");
+		}
+
+		std::memcpy(&header, bytes.data(), sizeof(Header));
+
+		if (header.magic != ColumnarFormat::MAGIC || header.version != ColumnarFormat::VERSION) {
+			throw std::runtime_error("ColumnarFormat: unsupported file");
+		}
+		if (header.alignment != ColumnarFormat::ALIGNMENT || header.dataOffset % ColumnarFormat::ALIGNMENT != 0u) {
+			throw std::runtime_error("ColumnarFormat: unsupported alignment");
+		}
+		if (header.dataOffset < sizeof(Header) || header.dataOffset > bytes.size()) {
+			throw std::runtime_error("ColumnarFormat: truncated data");
+		}
+		if (header.columnCount > (header.dataOffset - sizeof(Header)) / sizeof(std::uint32_t)) {
+			throw std::runtime_error("ColumnarFormat: truncated column names");
+		}
+		if (header.columnCount != 0u
+			&& header.rowCount > (bytes.size() - header.dataOffset) / sizeof(double) / header.columnCount) {
+			throw std::runtime_error("ColumnarFormat: truncated data");
+		}
+
+		return header;
+	}
+
+	[[nodiscard]] static std::vector<std::string> ReadColumnNames(std::span<const std::byte> bytes, const Header& header) {
+		std::vector<std::string> result;
+		auto offset = sizeof(Header);
+
+		for (auto i = 0u; i < header.columnCount; ++i) {
+			auto length = std::uint32_t{};
+
+			if (offset + sizeof(length) > header.dataOffset) {
+				throw std::runtime_error("ColumnarFormat: truncated column names");
+			}
+
+			std::memcpy(&length, bytes.data() + offset, sizeof(length));
+			offset += sizeof(length);
+
+			if (offset + length > header.dataOffset) {
+				throw std::runtime_error("ColumnarFormat: truncated column names");
+			}
+
+			result.emplace_back(reinterpret_cast<const char*>(bytes.data() + offset), length);
+			offset += length;
+		}
+
+		return result;
+	}
+
+private:
+	[[nodiscard]] static std::uint64_t AlignUp(const std::size_t size) {
+		return (size + ColumnarFormat::ALIGNMENT - 1u) / ColumnarFormat::ALIGNMENT * ColumnarFormat::ALIGNMENT;
+	}
+};
@@ -0,0 +1,65 @@
+#pragma once
+#include "CsvFormat.hpp"
+#include "MappedFile.hpp"
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <Eigen/Dense>
+
+class CsvChunkReader {
+public:
+	CsvChunkReader() = delete;
+
+	CsvChunkReader(const CsvChunkReader&) = delete;
+
+	explicit CsvChunkReader(const std::string& path, const double freedom) : file_(path), freedom_(freedom) {
+		const auto bytes = this->file_.GetBytes();
+
+		this->begin_ = reinterpret_cast<const char*>(bytes.data());
+		this->end_ = this->begin_ + bytes.size();
+		this->begin_ = CsvFormat::ReadHeader(this->begin_, this->end_, this->header_);
+	}
+
+	~CsvChunkReader() = default;
+
+	[[nodiscard]] const std::vector<std::string>& GetColumnNames() const {
+		return this->header_.columnNames;
+	}
+
+	[[nodiscard]] double GetFreedom() const {
+		return this->freedom_;
+	}
+
+	template <class Matrix, class Func>
+	void ForEachChunk(const Eigen::Index chunkRows, Func func) const {
+		Matrix chunk(chunkRows, static_cast<Eigen::Index>(this->header_.columnNames.size()));
+		auto chunkRow = Eigen::Index{};
+		auto row = std::size_t{};
+
+		CsvFormat::ForEachLine(this->begin_, this->end_, [this, &func, &chunk, &chunkRow, &row, chunkRows](const std::string_view line) {
+			CsvFormat::ParseRow(line, this->header_, row, [&chunk, chunkRow](const std::size_t column, const double value) {
+				chunk(chunkRow, static_cast<Eigen::Index>(column)) = value;
+			});
+
+			++row;
+
+			if (++chunkRow == chunkRows) {
+				func(chunk.topRows(chunkRow));
+				chunkRow = 0;
+			}
+		});
+
+		if (chunkRow != 0) {
+			func(chunk.topRows(chunkRow));
+		}
+	}
+
+private:
+	MappedFile file_;
+	CsvFormat::Header header_{};
+	double freedom_{};
+
+	const char* begin_{};
+	const char* end_{};
+};
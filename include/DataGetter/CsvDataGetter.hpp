@@ -0,0 +1,145 @@
+#pragma once
+#include "IDataGetter.hpp"
+#include "CsvFormat.hpp"
+#include "MappedFile.hpp"
+
+#include <cstring>
+#include <exception>
+#include <string_view>
+#include <thread>
+
+class CsvDataGetter : public IDataGetter {
+private:
+	static constexpr auto MIN_CHUNK_SIZE = std::size_t{ 1u } << 20u;
+
+	struct Chunk {
+		const char* begin;
+		const char* end;
+		std::size_t firstRow;
+		std::size_t rowCount;
+	};
+
+public:
+	explicit CsvDataGetter(const std::string& path, const double freedom,
+		const unsigned threadCount = std::max(1u, std::thread::hardware_concurrency()))
+		: file_(path), freedom_(freedom) {
+		this->ReadFile(threadCount);
+	}
+
+	CsvDataGetter(const CsvDataGetter&) = delete;
+
+	CsvDataGetter(CsvDataGetter&&) noexcept = default;
+
+	~CsvDataGetter() override = default;
+
+	[[nodiscard]] std::span<const double> GetData() const override {
+		return this->data_;
+	}
+
+	[[nodiscard]] Eigen::Index GetRowCount() const override {
+		return this->rows_;
+	}
+
+	[[nodiscard]] const std::vector<std::string>& GetColumnNames() const override {
+		return this->header_.columnNames;
+	}
+
+	[[nodiscard]] double GetFreedom() const override {
+		return this->freedom_;
+	}
+
+private:
+	MappedFile file_;
+
+	AlignedBuffer data_{};
+	Eigen::Index rows_{};
+	CsvFormat::Header header_{};
+	double freedom_{};
+
+	void ReadFile(const unsigned threadCount) {
+		const auto bytes = this->file_.GetBytes();
+		const auto* begin = reinterpret_cast<const char*>(bytes.data());
+		const auto* end = begin + bytes.size();
+
+		const auto* bodyBegin = CsvFormat::ReadHeader(begin, end, this->header_);
+		auto chunks = CsvDataGetter::SplitChunks(bodyBegin, end, threadCount);
+
+		CsvDataGetter::RunParallel(chunks, [](Chunk& chunk) {
+			CsvFormat::ForEachLine(chunk.begin, chunk.end, [&chunk](std::string_view) { ++chunk.rowCount; });
+		});
+
+		for (auto i = 1u; i < chunks.size(); ++i) {
+			chunks[i].firstRow = chunks[i - 1u].firstRow + chunks[i - 1u].rowCount;
+		}
+
+		this->rows_ = chunks.empty() ? 0 : static_cast<Eigen::Index>(chunks.back().firstRow + chunks.back().rowCount);
+		this->data_.resize(this->header_.columnNames.size() * static_cast<std::size_t>(this->rows_));
+
+		CsvDataGetter::RunParallel(chunks, [this](Chunk& chunk) { this->ParseChunk(chunk); });
+	}
+
+	void ParseChunk(const Chunk& chunk) {
+		auto row = chunk.firstRow;
+		auto* data = this->data_.data();
+		const auto rows = static_cast<std::size_t>(this->rows_);
+
+		CsvFormat::ForEachLine(chunk.begin, chunk.end, [&row, data, rows, this](const std::string_view line) {
+			CsvFormat::ParseRow(line, this->header_, row, [&row, data, rows](const std::size_t column, const double value) {
+				data[column * rows + row] = value;
+			});
+
+			++row;
+		});
+	}
+
+	[[nodiscard]] static std::vector<Chunk> SplitChunks(const char* begin, const char* end, const unsigned threadCount) {
+		std::vector<Chunk> result;
+		const auto size = static_cast<std::size_t>(end - begin);
+		const auto chunkSize = std::max(CsvDataGetter::MIN_CHUNK_SIZE, size / threadCount + 1u);
+
+		while (begin != end) {
+			const auto* chunkEnd = begin + std::min(chunkSize, static_cast<std::size_t>(end - begin));
+			const auto* lineEnd = static_cast<const char*>(std::memchr(chunkEnd - 1, '\n', static_cast<std::size_t>(end - chunkEnd + 1)));
+			chunkEnd = lineEnd == nullptr ? end : std::next(lineEnd);
+
+			result.push_back({ begin, chunkEnd, 0u, 0u });
+			begin = chunkEnd;
+		}
+
+		return result;
+	}
+
+	template <class Func>
+	static void RunParallel(std::vector<Chunk>& chunks, Func func) {
+		std::vector<std::exception_ptr> errors(chunks.size());
+		std::vector<std::thread> threads;
+
+		for (auto i = 1u; i < chunks.size(); ++i) {
+			threads.emplace_back([&chunks, &errors, &func, i] {
+				try {
+					func(chunks[i]);
+				}
+				catch (...) {
+					errors[i] = std::current_exception();
+				}
+			});
+		}
+
+		try {
+			if (!chunks.empty()) {
+				func(chunks.front());
+			}
+		}
+		catch (...) {
+			errors.front() = std::current_exception();
+		}
+
+		std::ranges::for_each(threads, [](auto& thread) { thread.join(); });
+
+		for (const auto& error : errors) {
+			if (error) {
+				std::rethrow_exception(error);
+			}
+		}
+	}
+};
@@ -0,0 +1,131 @@
+#pragma once
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class CsvFormat {
+private:
+	static constexpr auto* X_PREFIX_STR = "x";
+
+public:
+	struct Header {
+		char delimiter{ ',' };
+		std::vector<std::string> columnNames;
+		std::vector<int> fieldColumns;
+	};
+
+	CsvFormat() = delete;
+
+	[[nodiscard]] static const char* ReadHeader(const char* begin, const char* end, Header& header) {
+		if (begin == end) {
+			return end;
+		}
+
+		const auto* lineEnd = static_cast<const char*>(std::memchr(begin, '\n', static_cast<std::size_t>(end - begin)));
+		lineEnd = lineEnd == nullptr ? end : lineEnd;
+
+		const auto line = CsvFormat::TrimLine({ begin, static_cast<std::size_t>(lineEnd - begin) });
+		header.delimiter = std::ranges::count(line, '\t') > std::ranges::count(line, ',') ? '\t' : ',';
+
+		std::vector<std::string> fieldNames;
+		CsvFormat::ForEachField(line, header.delimiter, [&fieldNames](std::string_view field) {
+			while (!field.empty() && (field.front() == ' ' || field.front() == '"')) {
+				field.remove_prefix(1u);
+			}
+			while (!field.empty() && (field.back() == ' ' || field.back() == '"')) {
+				field.remove_suffix(1u);
+			}
+
+			fieldNames.emplace_back(field);
+		});
+
+		for (auto i = 1u; std::ranges::find(fieldNames, CsvFormat::X_PREFIX_STR + std::to_string(i)) != fieldNames.end(); ++i) {
+			header.columnNames.push_back(CsvFormat::X_PREFIX_STR + std::to_string(i));
+		}
+
+		header.fieldColumns.assign(fieldNames.size(), -1);
+
+		for (auto j = 0u; j < header.columnNames.size(); ++j) {
+			const auto field = std::ranges::find(fieldNames, header.columnNames[j]);
+			header.fieldColumns[static_cast<std::size_t>(std::distance(fieldNames.begin(), field))] = static_cast<int>(j);
+		}
+
+		return lineEnd == end ? end : std::next(lineEnd);
+	}
+
+	template <class Store>
+	static void ParseRow(const std::string_view line, const Header& header, const std::size_t row, Store store) {
+		auto field = 0u;
+		auto mappedFieldCount = std::size_t{};
+
+		CsvFormat::ForEachField(line, header.delimiter, [&field, &mappedFieldCount, &header, &store, row](std::string_view value) {
+			if (field < header.fieldColumns.size() && header.fieldColumns[field] >= 0) {
+				while (!value.empty() && value.front() == ' ') {
+					value.remove_prefix(1u);
+				}
+				while (!value.empty() && value.back() == ' ') {
+					value.remove_suffix(1u);
+				}
+
+				auto result = 0.0;
+				const auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), result);
+
+				if (ec != std::errc{} || value.empty() || ptr != value.data() + value.size()) {
+					throw std::runtime_error("CsvDataGetter: invalid number in row " + std::to_string(row + 1u));
+				}
+
+				store(static_cast<std::size_t>(header.fieldColumns[field]), result);
+				++mappedFieldCount;
+			}
+
+			++field;
+		});
+
+		if (mappedFieldCount != header.columnNames.size()) {
+			throw std::runtime_error("CsvDataGetter: missing field in row " + std::to_string(row + 1u));
+		}
+	}
+
+	template <class Func>
+	static void ForEachLine(const char* begin, const char* end, Func func) {
+		while (begin != end) {
+			const auto* lineEnd = static_cast<const char*>(std::memchr(begin, '\n', static_cast<std::size_t>(end - begin)));
+			lineEnd = lineEnd == nullptr ? end : lineEnd;
+
+			const auto line = CsvFormat::TrimLine({ begin, static_cast<std::size_t>(lineEnd - begin) });
+
+			if (!line.empty()) {
+				func(line);
+			}
+
+			begin = lineEnd == end ? end : std::next(lineEnd);
+		}
+	}
+
+	template <class Func>
+	static void ForEachField(std::string_view line, const char delimiter, Func func) {
+		while (true) {
+			const auto position = line.find(delimiter);
+			func(line.substr(0u, position));
+
+			if (position == std::string_view::npos) {
+				break;
+			}
+
+			line.remove_prefix(position + 1u);
+		}
+	}
+
+	[[nodiscard]] static std::string_view TrimLine(std::string_view line) {
+		if (!line.empty() && line.back() == '\r') {
+			line.remove_suffix(1u);
+		}
+
+		return line;
+	}
+};
@@ -0,0 +1,339 @@
+#pragma once
+#include "IDataGetter.hpp"
+#include "ColumnBuilder.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string_view>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define DATA_GETTER_SSE2
+	#include <emmintrin.h>
+#endif
+
+class FastJsonDataGetter : public IDataGetter {
+private:
+	static constexpr auto* X_PREFIX_STR = "x";
+	static constexpr auto* FREEDOM_STR  = "freedom";
+
+	static constexpr auto APPROX_NUMBER_LENGTH = 6u;
+
+public:
+	explicit FastJsonDataGetter(std::fstream& file) {
+		this->ReadFile(file);
+	}
+
+	explicit FastJsonDataGetter(std::string text) : text_(std::move(text)) {
+		this->Parse();
+	}
+
+	FastJsonDataGetter(const FastJsonDataGetter&) = delete;
+
+	FastJsonDataGetter(FastJsonDataGetter&&) noexcept = default;
+
+	~FastJsonDataGetter() override = default;
+
+	[[nodiscard]] std::span<const double> GetData() const override {
+		return this->data_;
+	}
+
+	[[nodiscard]] Eigen::Index GetRowCount() const override {
+		return this->rows_;
+	}
+
+	[[nodiscard]] const std::vector<std::string>& GetColumnNames() const override {
+		return this->columnNames_;
+	}
+
+	[[nodiscard]] double GetFreedom() const override {
+		return this->freedom_;
+	}
+
+private:
+	AlignedBuffer data_{};
+	Eigen::Index rows_{};
+	std::vector<std::string> columnNames_{};
+	double freedom_{};
+
+	std::string text_{};
+	const char* begin_{};
+	const char* pos_{};
+	const char* end_{};
+
+	void ReadFile(std::fstream& file) {
+		if (!file.is_open()) {
+			return;
+		}
+
+		file.seekg(0, std::ios_base::end);
+		this->text_.resize(static_cast<std::size_t>(file.tellg()));
+		file.seekg(0, std::ios_base::beg);
+		file.read(this->text_.data(), static_cast<std::streamsize>(this->text_.size()));
+		this->text_.resize(static_cast<std::size_t>(file.gcount()));
+
+		this->Parse();
+	}
+
+	void Parse() {
+		this->begin_ = this->text_.data();
+		this->pos_ = this->begin_;
+		this->end_ = this->begin_ + this->text_.size();
+
+		ColumnBuilder builder;
+		builder.Reserve(this->text_.size() / FastJsonDataGetter::APPROX_NUMBER_LENGTH);
+
+		this->ParseDocument(builder);
+		this->SkipWhitespace();
+
+		if (this->pos_ != this->end_) {
+			this->Throw();
+		}
+
+		for (auto i = 1u; builder.Contains(FastJsonDataGetter::X_PREFIX_STR + std::to_string(i)); ++i) {
+			this->columnNames_.push_back(FastJsonDataGetter::X_PREFIX_STR + std::to_string(i));
+		}
+
+		builder.Build(this->columnNames_, this->data_, this->rows_);
+
+		this->text_ = std::string{};
+	}
+
+	void ParseDocument(ColumnBuilder& builder) {
+		this->Expect('{');
+
+		if (this->Peek() == '}') {
+			++this->pos_;
+			return;
+		}
+
+		while (true) {
+			this->SkipWhitespace();
+			const auto key = this->ParseString();
+			this->Expect(':');
+
+			if (FastJsonDataGetter::IsColumnKey(key) && this->Peek() == '[') {
+				builder.BeginColumn(std::string(key));
+				this->ParseColumn(builder);
+			}
+			else if (key == FastJsonDataGetter::FREEDOM_STR && this->Peek() != '[' && this->Peek() != '{') {
+				this->freedom_ = this->ParseNumber();
+			}
+			else {
+				this->SkipValue();
+			}
+
+			if (this->Peek() == '}') {
+				++this->pos_;
+				break;
+			}
+
+			this->Expect(',');
+		}
+	}
+
+	void ParseColumn(ColumnBuilder& builder) {
+		++this->pos_;
+
+		if (this->Peek() == ']') {
+			++this->pos_;
+			return;
+		}
+
+		while (true) {
+			this->SkipWhitespace();
+			builder.Push(this->ParseNumber());
+
+			if (this->Peek() == ']') {
+				++this->pos_;
+				break;
+			}
+
+			this->Expect(',');
+		}
+	}
+
+	[[nodiscard]] double ParseNumber() {
+		this->SkipWhitespace();
+
+		auto result = 0.0;
+		const auto [ptr, ec] = std::from_chars(this->pos_, this->end_, result);
+
+		if (ec != std::errc{} || !FastJsonDataGetter::IsJsonNumber(this->pos_, ptr)) {
+			this->Throw();
+		}
+
+		this->pos_ = ptr;
+		return result;
+	}
+
+	[[nodiscard]] static bool IsJsonNumber(const char* first, const char* last) {
+		const auto isDigit = [last](const char* position) {
+			return position != last && static_cast<unsigned char>(*position - '0') < 10u;
+		};
+
+		if (first != last && *first == '-') {
+			++first;
+		}
+
+		if (!isDigit(first) || (*first == '0' && isDigit(first + 1))) {
+			return false;
+		}
+
+		const auto* dot = std::find(first, last, '.');
+
+		return dot == last || isDigit(dot + 1);
+	}
+
+	void SkipLiteral() {
+		for (const std::string_view literal : { "true", "false", "null" }) {
+			if (static_cast<std::size_t>(this->end_ - this->pos_) >= literal.size()
+				&& std::string_view(this->pos_, literal.size()) == literal) {
+				this->pos_ += literal.size();
+				return;
+			}
+		}
+
+		static_cast<void>(this->ParseNumber());
+	}
+
+	[[nodiscard]] std::string_view ParseString() {
+		if (this->pos_ == this->end_ || *this->pos_ != '"') {
+			this->Throw();
+		}
+
+		const auto* first = ++this->pos_;
+		this->SkipStringBody();
+
+		return { first, static_cast<std::size_t>(this->pos_ - 1 - first) };
+	}
+
+	void SkipStringBody() {
+		while (true) {
+			const auto* quote = static_cast<const char*>(std::memchr(this->pos_, '"', static_cast<std::size_t>(this->end_ - this->pos_)));
+
+			if (quote == nullptr) {
+				this->pos_ = this->end_;
+				this->Throw();
+			}
+
+			auto backslashes = 0u;
+			for (const auto* iter = quote; iter != this->pos_ && *(iter - 1) == '\\'; --iter) {
+				++backslashes;
+			}
+
+			this->pos_ = quote + 1;
+
+			if (backslashes % 2u == 0u) {
+				return;
+			}
+		}
+	}
+
+	void SkipValue() {
+		auto depth = 0u;
+
+		do {
+			this->SkipWhitespace();
+
+			if (this->pos_ == this->end_) {
+				this->Throw();
+			}
+
+			switch (*this->pos_) {
+			case '"':
+				++this->pos_;
+				this->SkipStringBody();
+				break;
+			case '{':
+			case '[':
+				++depth;
+				++this->pos_;
+				break;
+			case '}':
+			case ']':
+				if (depth == 0u) {
+					this->Throw();
+				}
+				--depth;
+				++this->pos_;
+				break;
+			case ',':
+			case ':':
+				if (depth == 0u) {
+					this->Throw();
+				}
+				++this->pos_;
+				break;
+			default:
+				this->SkipLiteral();
+				break;
+			}
+		} while (depth != 0u);
+	}
+
+	void SkipWhitespace() {
+		#if defined(DATA_GETTER_SSE2)
+			const auto space = _mm_set1_epi8(' ');
+			const auto tab = _mm_set1_epi8('\t');
+			const auto lf = _mm_set1_epi8('\n');
+			const auto cr = _mm_set1_epi8('\r');
+
+			while (this->end_ - this->pos_ >= 16 && FastJsonDataGetter::IsWhitespace(*this->pos_)) {
+				const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(this->pos_));
+				const auto isWhitespace = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, space), _mm_cmpeq_epi8(chunk, tab)),
+					_mm_or_si128(_mm_cmpeq_epi8(chunk, lf), _mm_cmpeq_epi8(chunk, cr)));
+				const auto mask = static_cast<unsigned>(_mm_movemask_epi8(isWhitespace)) ^ 0xFFFFu;
+
+				if (mask != 0u) {
+					auto offset = 0;
+					while ((mask & (1u << offset)) == 0u) {
+						++offset;
+					}
+
+					this->pos_ += offset;
+					return;
+				}
+
+				this->pos_ += 16;
+			}
+		#endif
+
+		while (this->pos_ != this->end_ && FastJsonDataGetter::IsWhitespace(*this->pos_)) {
+			++this->pos_;
+		}
+	}
+
+	[[nodiscard]] char Peek() {
+		this->SkipWhitespace();
+
+		if (this->pos_ == this->end_) {
+			this->Throw();
+		}
+
+		return *this->pos_;
+	}
+
+	void Expect(const char symbol) {
+		if (this->Peek() != symbol) {
+			this->Throw();
+		}
+
+		++this->pos_;
+	}
+
+	[[noreturn]] void Throw() const {
+		throw std::runtime_error("FastJsonDataGetter: syntax error at offset " + std::to_string(this->pos_ - this->begin_));
+	}
+
+	[[nodiscard]] static bool IsWhitespace(const char symbol) {
+		return symbol == ' ' || symbol == '\t' || symbol == '\n' || symbol == '\r';
+	}
+
+	[[nodiscard]] static bool IsColumnKey(const std::string_view key) {
+		return key.size() > 1u && key.starts_with(FastJsonDataGetter::X_PREFIX_STR)
+			&& std::all_of(std::next(key.begin()), key.end(), [](auto el) { return el >= '0' && el <= '9'; });
+	}
+};
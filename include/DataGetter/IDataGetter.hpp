@@ -1,17 +1,28 @@
 #pragma once
+#include <span>
+#include <string>
 #include <vector>
 #include <Eigen/Dense>
 
 using Eigen::Dynamic;
 using Eigen::MatrixXd;
 
+using AlignedBuffer = std::vector<double, Eigen::aligned_allocator<double>>;
+
 struct IDataGetter {
 public:
 	virtual ~IDataGetter() = default;
 
-	[[nodiscard]] virtual std::vector<double> GetDataX1() const = 0;
-	[[nodiscard]] virtual std::vector<double> GetDataX2() const = 0;
-	[[nodiscard]] virtual std::vector<double> GetDataX3() const = 0;
+	[[nodiscard]] virtual std::span<const double> GetData() const = 0;
+
+	[[nodiscard]] virtual Eigen::Index GetRowCount() const = 0;
+
+	[[nodiscard]] virtual const std::vector<std::string>& GetColumnNames() const = 0;
 
 	[[nodiscard]] virtual double GetFreedom() const = 0;
+
+	[[nodiscard]] std::span<const double> GetColumn(const Eigen::Index column) const {
+		const auto rows = static_cast<std::size_t>(this->GetRowCount());
+		return this->GetData().subspan(static_cast<std::size_t>(column) * rows, rows);
+	}
 };
@@ -1,50 +1,190 @@
 #pragma once
 #include "IDataGetter.hpp"
+#include "ColumnBuilder.hpp"
 
 #include <fstream>
+#include <stdexcept>
+#include <string_view>
 #include <nlohmann/json.hpp>
 
 class JsonDataGetter : public IDataGetter {
 private:
-	static constexpr auto* X1_STR		= "x1";
-	static constexpr auto* X2_STR		= "x2";
-	static constexpr auto* X3_STR		= "x3";
+	static constexpr auto* X_PREFIX_STR = "x";
 	static constexpr auto* FREEDOM_STR  = "freedom";
 
+	static constexpr auto APPROX_NUMBER_LENGTH = 6u;
+
+	class ColumnSax : public nlohmann::json_sax<nlohmann::json> {
+	public:
+		explicit ColumnSax(ColumnBuilder& builder, double& freedom) : builder_(builder), freedom_(freedom) {
+
+		}
+
+		bool null() override {
+			return this->NonNumber();
+		}
+
+		bool boolean(bool) override {
+			return this->NonNumber();
+		}
+
+		bool number_integer(number_integer_t val) override {
+			return this->Number(static_cast<double>(val));
+		}
+
+		bool number_unsigned(number_unsigned_t val) override {
+			return this->Number(static_cast<double>(val));
+		}
+
+		bool number_float(number_float_t val, const string_t&) override {
+			return this->Number(val);
+		}
+
+		bool string(string_t&) override {
+			return this->NonNumber();
+		}
+
+		bool binary(binary_t&) override {
+			return this->NonNumber();
+		}
+
+		bool start_object(std::size_t) override {
+			this->NonNumber();
+			++this->depth_;
+			return true;
+		}
+
+		bool end_object() override {
+			--this->depth_;
+			return true;
+		}
+
+		bool start_array(std::size_t) override {
+			this->NonNumber();
+
+			if (this->depth_ == 1u && ColumnSax::IsColumnKey(this->key_)) {
+				this->builder_.get().BeginColumn(this->key_);
+				this->isColumn_ = true;
+			}
+
+			++this->depth_;
+			return true;
+		}
+
+		bool end_array() override {
+			if (--this->depth_ == 1u) {
+				this->isColumn_ = false;
+			}
+
+			return true;
+		}
+
+		bool key(string_t& val) override {
+			if (this->depth_ == 1u) {
+				this->key_ = val;
+			}
+
+			return true;
+		}
+
+		bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception& ex) override {
+			throw std::runtime_error(ex.what());
+		}
+
+	private:
+		std::reference_wrapper<ColumnBuilder> builder_;
+		std::reference_wrapper<double> freedom_;
+
+		std::string key_{};
+		unsigned depth_{};
+		bool isColumn_{};
+
+		[[nodiscard]] static bool IsColumnKey(const std::string& key) {
+			return key.size() > 1u && key.starts_with(JsonDataGetter::X_PREFIX_STR)
+				&& std::all_of(std::next(key.begin()), key.end(), [](auto el) { return el >= '0' && el <= '9'; });
+		}
+
+		bool Number(const double value) {
+			if (this->isColumn_ && this->depth_ == 2u) {
+				this->builder_.get().Push(value);
+			}
+			else if (this->depth_ == 1u && this->key_ == JsonDataGetter::FREEDOM_STR) {
+				this->freedom_.get() = value;
+			}
+
+			return true;
+		}
+
+		bool NonNumber() const {
+			if (this->isColumn_) {
+				throw std::runtime_error("JsonDataGetter: non-numeric value in column " + this->key_);
+			}
+
+			return true;
+		}
+	};
+
 public:
-	explicit JsonDataGetter(std::fstream& file) : file_(file) {
-		this->ReadFile();
+	explicit JsonDataGetter(std::fstream& file) {
+		this->ReadFile(file);
+	}
+
+	explicit JsonDataGetter(std::string_view text) {
+		this->Parse(text, text.size());
 	}
-	;
+
 	JsonDataGetter(const JsonDataGetter&) = delete;
 
 	JsonDataGetter(JsonDataGetter&&) noexcept = default;
 
 	~JsonDataGetter() override = default;
 
-	[[nodiscard]] std::vector<double> GetDataX1() const override {
-		return this->json_[JsonDataGetter::X1_STR].get<std::vector<double>>();
+	[[nodiscard]] std::span<const double> GetData() const override {
+		return this->data_;
 	}
 
-	[[nodiscard]] std::vector<double> GetDataX2() const override {
-		return this->json_[JsonDataGetter::X2_STR].get<std::vector<double>>();
+	[[nodiscard]] Eigen::Index GetRowCount() const override {
+		return this->rows_;
 	}
 
-	[[nodiscard]] std::vector<double> GetDataX3() const override {
-		return this->json_[JsonDataGetter::X3_STR].get<std::vector<double>>();
+	[[nodiscard]] const std::vector<std::string>& GetColumnNames() const override {
+		return this->columnNames_;
 	}
 
 	[[nodiscard]] double GetFreedom() const override {
-		return this->json_[JsonDataGetter::FREEDOM_STR].get<double>();
+		return this->freedom_;
 	}
 
 private:
-	std::reference_wrapper<std::fstream> file_;
-	nlohmann::json json_{};
+	AlignedBuffer data_{};
+	Eigen::Index rows_{};
+	std::vector<std::string> columnNames_{};
+	double freedom_{};
 
-	void ReadFile() {
-		if (this->file_.get().is_open()) {
-			this->file_ >> this->json_;
+	void ReadFile(std::fstream& file) {
+		if (!file.is_open()) {
+			return;
 		}
+
+		file.seekg(0, std::ios_base::end);
+		const auto fileSize = static_cast<std::size_t>(file.tellg());
+		file.seekg(0, std::ios_base::beg);
+
+		this->Parse(static_cast<std::istream&>(file), fileSize);
+	}
+
+	template <class Input>
+	void Parse(Input&& input, const std::size_t size) {
+		ColumnBuilder builder;
+		builder.Reserve(size / JsonDataGetter::APPROX_NUMBER_LENGTH);
+
+		ColumnSax sax(builder, this->freedom_);
+		nlohmann::json::sax_parse(std::forward<Input>(input), &sax);
+
+		for (auto i = 1u; builder.Contains(JsonDataGetter::X_PREFIX_STR + std::to_string(i)); ++i) {
+			this->columnNames_.push_back(JsonDataGetter::X_PREFIX_STR + std::to_string(i));
+		}
+
+		builder.Build(this->columnNames_, this->data_, this->rows_);
 	}
 };
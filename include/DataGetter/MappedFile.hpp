@@ -0,0 +1,130 @@
+#pragma once
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#if defined(_WIN32)
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+	#include <Windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+class MappedFile {
+public:
+	explicit MappedFile(const std::string& path) {
+		this->Map(path);
+	}
+
+	MappedFile(const MappedFile&) = delete;
+
+	MappedFile(MappedFile&& other) noexcept
+		: data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0u)) {
+		#if defined(_WIN32)
+			this->file_ = std::exchange(other.file_, INVALID_HANDLE_VALUE);
+			this->mapping_ = std::exchange(other.mapping_, nullptr);
+		#endif
+	}
+
+	~MappedFile() {
+		this->Unmap();
+	}
+
+	[[nodiscard]] std::span<const std::byte> GetBytes() const {
+		return { this->data_, this->size_ };
+	}
+
+	[[nodiscard]] std::size_t GetSize() const {
+		return this->size_;
+	}
+
+private:
+	const std::byte* data_{};
+	std::size_t size_{};
+
+	#if defined(_WIN32)
+		HANDLE file_{ INVALID_HANDLE_VALUE };
+		HANDLE mapping_{};
+	#endif
+
+	void Map(const std::string& path) {
+		#if defined(_WIN32)
+			this->file_ = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+			LARGE_INTEGER size{};
+			if (this->file_ == INVALID_HANDLE_VALUE || !GetFileSizeEx(this->file_, &size)) {
+				this->Unmap();
+				throw std::runtime_error("MappedFile: cannot open " + path);
+			}
+
+			this->size_ = static_cast<std::size_t>(size.QuadPart);
+
+			if (this->size_ == 0u) {
+				return;
+			}
+
+			this->mapping_ = CreateFileMappingA(this->file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			this->data_ = this->mapping_ == nullptr
+				? nullptr : static_cast<const std::byte*>(MapViewOfFile(this->mapping_, FILE_MAP_READ, 0, 0, 0));
+		#else
+			const auto descriptor = open(path.c_str(), O_RDONLY);
+
+			struct stat status{};
+			if (descriptor < 0 || fstat(descriptor, &status) != 0) {
+				if (descriptor >= 0) {
+					close(descriptor);
+				}
+
+				throw std::runtime_error("MappedFile: cannot open " + path);
+			}
+
+			this->size_ = static_cast<std::size_t>(status.st_size);
+
+			if (this->size_ == 0u) {
+				close(descriptor);
+				return;
+			}
+
+			auto* address = mmap(nullptr, this->size_, PROT_READ, MAP_PRIVATE, descriptor, 0);
+			close(descriptor);
+
+			this->data_ = address == MAP_FAILED ? nullptr : static_cast<const std::byte*>(address);
+		#endif
+
+		if (this->data_ == nullptr) {
+			this->Unmap();
+			throw std::runtime_error("MappedFile: cannot map " + path);
+		}
+	}
+
+	void Unmap() {
+		#if defined(_WIN32)
+			if (this->data_ != nullptr) {
+				UnmapViewOfFile(this->data_);
+			}
+			if (this->mapping_ != nullptr) {
+				CloseHandle(this->mapping_);
+			}
+			if (this->file_ != INVALID_HANDLE_VALUE) {
+				CloseHandle(this->file_);
+			}
+
+			this->mapping_ = nullptr;
+			this->file_ = INVALID_HANDLE_VALUE;
+		#else
+			if (this->data_ != nullptr) {
+				munmap(const_cast<std::byte*>(this->data_), this->size_);
+			}
+		#endif
+
+		this->data_ = nullptr;
+		this->size_ = 0u;
+	}
+};
@@ -0,0 +1,51 @@
+#pragma once
+#include "IDataGetter.hpp"
+#include "ColumnarFormat.hpp"
+#include "MappedFile.hpp"
+
+class MmapDataGetter : public IDataGetter {
+public:
+	explicit MmapDataGetter(const std::string& path) : file_(path) {
+		this->ReadHeader();
+	}
+
+	MmapDataGetter(const MmapDataGetter&) = delete;
+
+	MmapDataGetter(MmapDataGetter&&) noexcept = default;
+
+	~MmapDataGetter() override = default;
+
+	[[nodiscard]] std::span<const double> GetData() const override {
+		return this->data_;
+	}
+
+	[[nodiscard]] Eigen::Index GetRowCount() const override {
+		return this->rows_;
+	}
+
+	[[nodiscard]] const std::vector<std::string>& GetColumnNames() const override {
+		return this->columnNames_;
+	}
+
+	[[nodiscard]] double GetFreedom() const override {
+		return this->freedom_;
+	}
+
+private:
+	MappedFile file_;
+
+	std::span<const double> data_{};
+	Eigen::Index rows_{};
+	std::vector<std::string> columnNames_{};
+	double freedom_{};
+
+	void ReadHeader() {
+		const auto bytes = this->file_.GetBytes();
+		const auto header = ColumnarFormat::ReadHeader(bytes);
+
+		this->columnNames_ = ColumnarFormat::ReadColumnNames(bytes, header);
+		this->rows_ = static_cast<Eigen::Index>(header.rowCount);
+		this->freedom_ = header.freedom;
+		this->data_ = { reinterpret_cast<const double*>(bytes.data() + header.dataOffset), header.rowCount * header.columnCount };
+	}
+};
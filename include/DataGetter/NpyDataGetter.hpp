@@ -0,0 +1,348 @@
+#pragma once
+#include "IDataGetter.hpp"
+#include "MappedFile.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <string_view>
+
+class NpyDataGetter : public IDataGetter {
+private:
+	static constexpr auto* X_PREFIX_STR		= "x";
+	static constexpr auto* FREEDOM_ENTRY_STR	= "freedom.npy";
+
+	static constexpr std::string_view NPY_MAGIC{ "\x93NUMPY", 6u };
+	static constexpr std::string_view ZIP_MAGIC{ "PK\x03\x04", 4u };
+
+	static constexpr auto TILE_SIZE = std::size_t{ 64u };
+
+	struct Array {
+		const std::byte* data;
+		std::size_t rows;
+		std::size_t cols;
+		std::size_t itemSize;
+		bool isFortranOrder;
+	};
+
+public:
+	explicit NpyDataGetter(const std::string& path, const double freedom) : file_(path), freedom_(freedom) {
+		this->ReadFile();
+	}
+
+	NpyDataGetter(const NpyDataGetter&) = delete;
+
+	NpyDataGetter(NpyDataGetter&&) noexcept = default;
+
+	~NpyDataGetter() override = default;
+
+	[[nodiscard]] std::span<const double> GetData() const override {
+		return this->data_;
+	}
+
+	[[nodiscard]] Eigen::Index GetRowCount() const override {
+		return this->rows_;
+	}
+
+	[[nodiscard]] const std::vector<std::string>& GetColumnNames() const override {
+		return this->columnNames_;
+	}
+
+	[[nodiscard]] double GetFreedom() const override {
+		return this->freedom_;
+	}
+
+private:
+	MappedFile file_;
+
+	AlignedBuffer ownedData_{};
+	std::span<const double> data_{};
+	Eigen::Index rows_{};
+	std::vector<std::string> columnNames_{};
+	double freedom_{};
+
+	void ReadFile() {
+		const auto bytes = this->file_.GetBytes();
+		const auto prefix = NpyDataGetter::AsString(bytes.first(std::min<std::size_t>(bytes.size(), 6u)));
+
+		if (prefix.starts_with(NpyDataGetter::NPY_MAGIC)) {
+			this->ReadArray(NpyDataGetter::ParseArray(bytes));
+		}
+		else if (prefix.starts_with(NpyDataGetter::ZIP_MAGIC)) {
+			this->ReadArchive(bytes);
+		}
+		else {
+			throw std::runtime_error("NpyDataGetter: not a .npy or .npz file");
+		}
+	}
+
+	void ReadArchive(std::span<const std::byte> bytes) {
+		std::optional<Array> array;
+
+		NpyDataGetter::ForEachZipEntry(bytes, [&array, this](const std::string_view name, std::span<const std::byte> entry) {
+			if (name == NpyDataGetter::FREEDOM_ENTRY_STR) {
+				const auto freedom = NpyDataGetter::ParseArray(entry);
+				this->freedom_ = freedom.itemSize == sizeof(double)
+					? NpyDataGetter::Load<double>(freedom.data) : NpyDataGetter::Load<float>(freedom.data);
+			}
+			else if (!array.has_value() && name.ends_with(".npy")) {
+				array = NpyDataGetter::ParseArray(entry);
+			}
+		});
+
+		if (!array.has_value()) {
+			throw std::runtime_error("NpyDataGetter: the archive holds no arrays");
+		}
+
+		this->ReadArray(*array);
+	}
+
+	void ReadArray(const Array& array) {
+		this->rows_ = static_cast<Eigen::Index>(array.rows);
+
+		for (auto j = 1u; j <= array.cols; ++j) {
+			this->columnNames_.push_back(NpyDataGetter::X_PREFIX_STR + std::to_string(j));
+		}
+
+		const auto isAligned = reinterpret_cast<std::uintptr_t>(array.data) % alignof(double) == 0u;
+
+		if (array.itemSize == sizeof(double) && (array.isFortranOrder || array.cols == 1u) && isAligned) {
+			this->data_ = { reinterpret_cast<const double*>(array.data), array.rows * array.cols };
+			return;
+		}
+
+		this->ownedData_.resize(array.rows * array.cols);
+
+		if (array.itemSize == sizeof(double)) {
+			this->CopyColumns<double>(array);
+		}
+		else {
+			this->CopyColumns<float>(array);
+		}
+
+		this->data_ = this->ownedData_;
+	}
+
+	template <class T>
+	void CopyColumns(const Array& array) {
+		auto* destination = this->ownedData_.data();
+
+		if (array.isFortranOrder || array.cols == 1u) {
+			for (auto i = 0u; i < array.rows * array.cols; ++i) {
+				destination[i] = NpyDataGetter::Load<T>(array.data + i * sizeof(T));
+			}
+
+			return;
+		}
+
+		for (auto rowTile = std::size_t{}; rowTile < array.rows; rowTile += NpyDataGetter::TILE_SIZE) {
+			const auto rowEnd = std::min(rowTile + NpyDataGetter::TILE_SIZE, array.rows);
+
+			for (auto colTile = std::size_t{}; colTile < array.cols; colTile += NpyDataGetter::TILE_SIZE) {
+				const auto colEnd = std::min(colTile + NpyDataGetter::TILE_SIZE, array.cols);
+
+				for (auto i = rowTile; i < rowEnd; ++i) {
+					for (auto j = colTile; j < colEnd; ++j) {
+						destination[j * array.rows + i] = NpyDataGetter::Load<T>(array.data + (i * array.cols + j) * sizeof(T));
+					}
+				}
+			}
+		}
+	}
+
+	[[nodiscard]] static Array ParseArray(std::span<const std::byte> bytes) {
+		if (bytes.size() < 10u || !NpyDataGetter::AsString(bytes).starts_with(NpyDataGetter::NPY_MAGIC)) {
+			throw std::runtime_error("NpyDataGetter: invalid .npy header");
+		}
+
+		const auto major = static_cast<unsigned>(bytes[6]);
+		const auto lengthSize = major == 1u ? 2u : 4u;
+		auto headerLength = std::size_t{};
+
+		for (auto i = 0u; i < lengthSize; ++i) {
+			headerLength |= static_cast<std::size_t>(bytes[8u + i]) << (8u * i);
+		}
+
+		const auto dataOffset = 8u + lengthSize + headerLength;
+
+		if (dataOffset > bytes.size()) {
+			throw std::runtime_error("NpyDataGetter: truncated .npy header");
+		}
+
+		const auto header = NpyDataGetter::AsString(bytes.subspan(8u + lengthSize, headerLength));
+		const auto descr = NpyDataGetter::FindValue(header, "descr");
+		const auto shape = NpyDataGetter::FindValue(header, "shape");
+
+		Array result{ bytes.data() + dataOffset, 1u, 1u, 0u, NpyDataGetter::FindValue(header, "fortran_order").starts_with("True") };
+
+		if (descr.starts_with("'<f8'") || descr.starts_with("'f8'")) {
+			result.itemSize = sizeof(double);
+		}
+		else if (descr.starts_with("'<f4'") || descr.starts_with("'f4'")) {
+			result.itemSize = sizeof(float);
+		}
+		else {
+			throw std::runtime_error("NpyDataGetter: only little-endian float64 and float32 arrays are supported");
+		}
+
+		const auto dimensions = NpyDataGetter::ParseShape(shape);
+
+		if (dimensions.size() > 2u) {
+			throw std::runtime_error("NpyDataGetter: only 1-D and 2-D arrays are supported");
+		}
+
+		result.rows = dimensions.empty() ? 1u : dimensions[0];
+		result.cols = dimensions.size() < 2u ? 1u : dimensions[1];
+
+		if (result.rows == 0u || result.cols == 0u) {
+			throw std::runtime_error("NpyDataGetter: empty .npy array");
+		}
+		if (result.rows > (bytes.size() - dataOffset) / result.itemSize / result.cols) {
+			throw std::runtime_error("NpyDataGetter: truncated .npy data");
+		}
+
+		return result;
+	}
+
+	[[nodiscard]] static std::vector<std::size_t> ParseShape(std::string_view shape) {
+		std::vector<std::size_t> result;
+		shape = shape.substr(0u, shape.find(')'));
+
+		for (auto position = shape.find_first_of("0123456789"); position != std::string_view::npos;
+			position = shape.find_first_of("0123456789", position)) {
+			auto value = std::size_t{};
+
+			for (; position < shape.size() && shape[position] >= '0' && shape[position] <= '9'; ++position) {
+				const auto digit = static_cast<std::size_t>(shape[position] - '0');
+
+				if (value > (std::numeric_limits<std::size_t>::max() - digit) / 10u) {
+					throw std::runtime_error("NpyDataGetter: .npy shape is too large");
+				}
+
+				value = value * 10u + digit;
+			}
+
+			result.push_back(value);
+		}
+
+		return result;
+	}
+
+	[[nodiscard]] static std::string_view FindValue(const std::string_view header, const std::string_view key) {
+		const auto position = header.find("'" + std::string(key) + "'");
+
+		if (position == std::string_view::npos) {
+			throw std::runtime_error("NpyDataGetter: missing '" + std::string(key) + "' in .npy header");
+		}
+
+		auto value = header.substr(header.find(':', position) + 1u);
+		return value.substr(value.find_first_not_of(' '));
+	}
+
+	template <class Func>
+	static void ForEachZipEntry(std::span<const std::byte> bytes, Func func) {
+		constexpr auto EOCD_SIGNATURE = 0x06054b50u;
+		constexpr auto ZIP64_LOCATOR_SIGNATURE = 0x07064b50u;
+		constexpr auto CENTRAL_SIGNATURE = 0x02014b50u;
+		constexpr auto EOCD_SIZE = std::size_t{ 22u };
+
+		if (bytes.size() < EOCD_SIZE) {
+			throw std::runtime_error("NpyDataGetter: truncated .npz archive");
+		}
+
+		auto eocd = bytes.size() - EOCD_SIZE;
+		while (NpyDataGetter::ReadLe(bytes, eocd, 4u) != EOCD_SIGNATURE) {
+			if (eocd == 0u) {
+				throw std::runtime_error("NpyDataGetter: invalid .npz archive");
+			}
+
+			--eocd;
+		}
+
+		auto entryCount = NpyDataGetter::ReadLe(bytes, eocd + 10u, 2u);
+		auto offset = NpyDataGetter::ReadLe(bytes, eocd + 16u, 4u);
+
+		if (eocd >= 20u && NpyDataGetter::ReadLe(bytes, eocd - 20u, 4u) == ZIP64_LOCATOR_SIGNATURE) {
+			const auto zip64Eocd = NpyDataGetter::ReadLe(bytes, eocd - 12u, 8u);
+			entryCount = NpyDataGetter::ReadLe(bytes, zip64Eocd + 32u, 8u);
+			offset = NpyDataGetter::ReadLe(bytes, zip64Eocd + 48u, 8u);
+		}
+
+		for (auto i = std::uint64_t{}; i < entryCount; ++i) {
+			if (NpyDataGetter::ReadLe(bytes, offset, 4u) != CENTRAL_SIGNATURE) {
+				throw std::runtime_error("NpyDataGetter: invalid .npz central directory");
+			}
+
+			const auto method = NpyDataGetter::ReadLe(bytes, offset + 10u, 2u);
+			auto size = NpyDataGetter::ReadLe(bytes, offset + 20u, 4u);
+			auto uncompressedSize = NpyDataGetter::ReadLe(bytes, offset + 24u, 4u);
+			const auto nameLength = NpyDataGetter::ReadLe(bytes, offset + 28u, 2u);
+			const auto extraLength = NpyDataGetter::ReadLe(bytes, offset + 30u, 2u);
+			const auto commentLength = NpyDataGetter::ReadLe(bytes, offset + 32u, 2u);
+			auto localOffset = NpyDataGetter::ReadLe(bytes, offset + 42u, 4u);
+			const auto name = NpyDataGetter::AsString(bytes.subspan(offset + 46u, nameLength));
+
+			for (auto extra = offset + 46u + nameLength; extra + 4u <= offset + 46u + nameLength + extraLength;) {
+				const auto id = NpyDataGetter::ReadLe(bytes, extra, 2u);
+				const auto length = NpyDataGetter::ReadLe(bytes, extra + 2u, 2u);
+				auto field = extra + 4u;
+
+				if (id == 0x0001u) {
+					if (uncompressedSize == 0xFFFFFFFFu) {
+						uncompressedSize = NpyDataGetter::ReadLe(bytes, field, 8u);
+						field += 8u;
+					}
+					if (size == 0xFFFFFFFFu) {
+						size = NpyDataGetter::ReadLe(bytes, field, 8u);
+						field += 8u;
+					}
+					if (localOffset == 0xFFFFFFFFu) {
+						localOffset = NpyDataGetter::ReadLe(bytes, field, 8u);
+					}
+				}
+
+				extra += 4u + length;
+			}
+
+			if (method != 0u || size != uncompressedSize) {
+				throw std::runtime_error("NpyDataGetter: compressed .npz archives are not supported");
+			}
+
+			const auto dataOffset = localOffset + 30u
+				+ NpyDataGetter::ReadLe(bytes, localOffset + 26u, 2u) + NpyDataGetter::ReadLe(bytes, localOffset + 28u, 2u);
+
+			if (dataOffset + size > bytes.size()) {
+				throw std::runtime_error("NpyDataGetter: truncated .npz entry");
+			}
+
+			func(name, bytes.subspan(dataOffset, size));
+			offset += 46u + nameLength + extraLength + commentLength;
+		}
+	}
+
+	[[nodiscard]] static std::uint64_t ReadLe(std::span<const std::byte> bytes, const std::uint64_t offset, const unsigned size) {
+		if (offset + size > bytes.size()) {
+			throw std::runtime_error("NpyDataGetter: truncated .npz archive");
+		}
+
+		auto result = std::uint64_t{};
+
+		for (auto i = 0u; i < size; ++i) {
+			result |= static_cast<std::uint64_t>(bytes[offset + i]) << (8u * i);
+		}
+
+		return result;
+	}
+
+	template <class T>
+	[[nodiscard]] static double Load(const std::byte* data) {
+		T result;
+		std::memcpy(&result, data, sizeof(T));
+		return static_cast<double>(result);
+	}
+
+	[[nodiscard]] static std::string_view AsString(std::span<const std::byte> bytes) {
+		return { reinterpret_cast<const char*>(bytes.data()), bytes.size() };
+	}
+};
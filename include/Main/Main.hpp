@@ -4,6 +4,39 @@
 class Main {
 private:
 	static const std::pair <const char*, const char*> FILES_ARG_STR;
+	static const std::pair <const char*, const char*> PARSER_ARG_STR;
+	static const std::pair <const char*, const char*> CONVERT_ARG_STR;
+	static const std::pair <const char*, const char*> FREEDOM_ARG_STR;
+	static const std::pair <const char*, const char*> STREAM_ARG_STR;
+	static const std::pair <const char*, const char*> CHUNK_ROWS_ARG_STR;
+	static const std::pair <const char*, const char*> SNAPSHOT_ARG_STR;
+	static const std::pair <const char*, const char*> MERGE_ARG_STR;
+	static const std::pair <const char*, const char*> WINDOW_ARG_STR;
+	static const std::pair <const char*, const char*> STEP_ARG_STR;
+	static const std::pair <const char*, const char*> HALF_LIFE_ARG_STR;
+	static const std::pair <const char*, const char*> JOBS_ARG_STR;
+	static const std::pair <const char*, const char*> UNORDERED_ARG_STR;
+	static const std::pair <const char*, const char*> PIPELINE_ARG_STR;
+	static const std::pair <const char*, const char*> FULL_ARG_STR;
+	static const std::pair <const char*, const char*> ADJUST_ARG_STR;
+	static const std::pair <const char*, const char*> FORMAT_ARG_STR;
+	static const std::pair <const char*, const char*> OUTPUT_ARG_STR;
+
+	static constexpr std::size_t ROW_BUFFER_SIZE = 1u << 20u;
+	static constexpr std::size_t PIPELINE_QUEUE_SIZE = 4u;
+	static constexpr std::size_t OUTPUT_BUFFER_SIZE = 1u << 22u;
+
+	static constexpr auto* SAX_PARSER_STR	= "sax";
+	static constexpr auto* FAST_PARSER_STR	= "fast";
+
+	static constexpr auto* NONE_ADJUSTMENT_STR	= "none";
+	static constexpr auto* HOLM_ADJUSTMENT_STR	= "holm";
+	static constexpr auto* BH_ADJUSTMENT_STR	= "bh";
+
+	static constexpr auto* TEXT_FORMAT_STR		= "text";
+	static constexpr auto* JSONL_FORMAT_STR		= "jsonl";
+	static constexpr auto* CSV_FORMAT_STR		= "csv";
+	static constexpr auto* BINARY_FORMAT_STR	= "binary";
 
 public:
 	Main() = delete;
@@ -25,119 +58,1068 @@ public:
 			this->ParseArgs();
 		}
 		catch (const std::exception&) {
-			fmt::print(fmt::fg(fmt::color::orange),
+			fmt::print(stderr, fmt::fg(fmt::color::orange),
 				"!     ...\n: {} {} fileName.json\n",
 				this->argv_.front(), Main::FILES_ARG_STR.second);
 
 			return EXIT_FAILURE;
 		}
 
-		for (auto filePath : this->filePaths_) {
+		try {
+			this->OpenOutput();
 
-			std::fstream file(filePath, std::ios_base::in);
-			const std::unique_ptr<IDataGetter> dataGetter = std::make_unique<JsonDataGetter>(file);
+			if (this->merge_) {
+				this->SolveSnapshots();
+			}
+			else if (this->jobs_ > 1u) {
+				this->SolveFilesParallel();
+			}
+			else if (this->pipeline_) {
+				this->SolveFilesPipelined();
+			}
+			else {
+				for (const auto& filePath : this->filePaths_) {
+					this->SolveFilePath(filePath, this->GetOutput());
+				}
+			}
 
-			const auto [x1, x2, x3] =
-				std::make_tuple(dataGetter->GetDataX1(), dataGetter->GetDataX2(), dataGetter->GetDataX3());
+			this->CloseOutput();
+		}
+		catch (const std::exception& exception) {
+			this->GetOutput().flush();
+			fmt::print(stderr, fmt::fg(fmt::color::red), "! {}\n", exception.what());
 
-			const auto solver = std::make_unique<MathSolver>(x1, x2, x3);
-			std::cout << solver->GetAllData() << std::endl;
+			return EXIT_FAILURE;
+		}
 
-			Main::PrintDelimiter(std::cout);
+		return EXIT_SUCCESS;
+	}
 
-			std::cout << std::format("Sum x1: {:.4f}\tSum x1^2: {:.4f}\nSum x2: {:.4f}\tSum x2^2: {:.4f}\nSum x3: {:.4f}\tSum x3^2: {:.4f}\n",
-				solver->GetX1Sum(), solver->GetX1SquareSum(), solver->GetX2Sum(),
-				solver->GetX2SquareSum(), solver->GetX3Sum(), solver->GetX3SquareSum());
+private:
+	void OpenOutput() {
+		if (!this->outputPath_.empty()) {
+			this->outputBuffer_ = std::make_unique<char[]>(Main::OUTPUT_BUFFER_SIZE);
+			this->output_ = std::make_unique<std::ofstream>();
+			this->output_->rdbuf()->pubsetbuf(this->outputBuffer_.get(), static_cast<std::streamsize>(Main::OUTPUT_BUFFER_SIZE));
+			this->output_->open(this->outputPath_, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
 
-			Main::PrintDelimiter(std::cout);
+			if (!this->output_->is_open()) {
+				throw std::runtime_error("cannot create " + this->outputPath_);
+			}
+		}
 
-			std::cout << solver->NormalizedMatrix() << std::endl;
+		if (this->resultWriter_) {
+			fmt::memory_buffer buffer;
+			this->resultWriter_->WriteHeader(buffer);
+			this->GetOutput().write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+		}
+	}
 
-			Main::PrintDelimiter(std::cout);
+	void CloseOutput() const {
+		if (!this->GetOutput().flush()) {
+			throw std::runtime_error("cannot write " + (this->outputPath_.empty() ? std::string("the output") : this->outputPath_));
+		}
+	}
 
-			std::cout << solver->CorrelationMatrix() << std::endl;
+	[[nodiscard]] std::ostream& GetOutput() const {
+		return this->output_ ? *this->output_ : std::cout;
+	}
 
-			Main::PrintDelimiter(std::cout);
+	void WriteOutput(const std::string_view text) const {
+		auto& out = this->GetOutput();
+		out.write(text.data(), static_cast<std::streamsize>(text.size()));
 
-			std::cout << std::format(" R: {:.4f}\n", solver->CorrelationDeterminant());
+		if (!this->output_) {
+			out.flush();
+		}
+	}
 
-			auto [xi_, xit] = std::make_tuple(solver->GetXi(), PearsonTable::GetInstance().GetElement(1.0 - dataGetter->GetFreedom(), 3));
+	static void SetLocale(unsigned code) {
+		#if defined(_WIN32)
+			SetConsoleCP(code);
+			SetConsoleOutputCP(code);
+		#endif
+	}
 
-			std::cout << std::format(" Xi: {:.4f}\n", xi_);
-			std::cout << std::format("  Xi: {:.4f}\n", xit);
+	void SolveFilesParallel() const {
+		std::vector<std::future<std::string>> outputs;
+		outputs.reserve(this->filePaths_.size());
 
-			Main::PrintDelimiter(std::cout);
+		std::mutex outputMutex;
+		std::atomic<std::size_t> failedIndex{ this->filePaths_.size() };
 
-			if (xi_ > xit) {
-				std::cout << solver->CMatrix() << std::endl;
+		const auto pool = std::make_unique<WorkStealingPool>(this->jobs_);
 
-				Main::PrintDelimiter(std::cout);
+		for (auto index = std::size_t{}; index < this->filePaths_.size(); ++index) {
+			outputs.push_back(pool->Submit([this, index, &outputMutex, &failedIndex] {
+				if (this->IsCancelled(index, failedIndex.load())) {
+					return std::string();
+				}
 
-				const auto [x1F, x2F, x3F] = solver->GetAllFStatistics();
-				const auto f = std::make_unique<FisherF>(15, 2)->GetFStatistics(1.0 - dataGetter->GetFreedom());
+				std::ostringstream out;
 
-				std::cout << std::format("F- x1: {:.4f}\n", x1F);
-				std::cout << std::format("F- x2: {:.4f}\n", x2F);
-				std::cout << std::format("F- x3: {:.4f}\n", x3F);
+				try {
+					this->SolveFilePath(this->filePaths_[index], out);
+				}
+				catch (...) {
+					auto failed = failedIndex.load();
 
-				Main::PrintDelimiter(std::cout);
+					while (index < failed && !failedIndex.compare_exchange_weak(failed, index)) {
 
-				std::cout << std::format("  F: {:.4f}\n", f);
+					}
 
-				if (x1F > f && x2F > f && x3F > f) {
-					const auto [x1R, x2R, x3R] = solver->GetAllDetermination();
+					throw;
+				}
+
+				if (!this->unordered_) {
+					return std::move(out).str();
+				}
+
+				const std::lock_guard lock(outputMutex);
+				this->WriteOutput(out.view());
+
+				return std::string();
+			}));
+		}
 
-					std::cout << std::format("  x1: {:.4f}\n", x1R);
-					std::cout << std::format("  x2: {:.4f}\n", x2R);
-					std::cout << std::format("  x3: {:.4f}\n", x3R);
+		for (auto& output : outputs) {
+			this->WriteOutput(output.get());
+		}
+	}
 
-					Main::PrintDelimiter(std::cout);
+	[[nodiscard]] bool IsCancelled(const std::size_t index, const std::size_t failedIndex) const {
+		return this->unordered_ ? failedIndex != this->filePaths_.size() : index > failedIndex;
+	}
 
-					std::cout << solver->PartialCorrelationMatrix() << std::endl;
+	struct PipelineItem {
+		std::string filePath;
+		std::optional<std::string> text{};
+		std::unique_ptr<IDataGetter> dataGetter{};
+		std::function<void(std::ostream&)> formatter{};
+		std::string output{};
+		std::exception_ptr error{};
+	};
 
-					Main::PrintDelimiter(std::cout);
+	struct PipelineStage {
+		const char* name;
+		std::chrono::nanoseconds busy{};
+	};
 
-					std::cout << solver->GetTCriteria() << std::endl;
+	void SolveFilesPipelined() const {
+		std::array<BoundedQueue<PipelineItem>, 4u> queues{
+			BoundedQueue<PipelineItem>(Main::PIPELINE_QUEUE_SIZE), BoundedQueue<PipelineItem>(Main::PIPELINE_QUEUE_SIZE),
+			BoundedQueue<PipelineItem>(Main::PIPELINE_QUEUE_SIZE), BoundedQueue<PipelineItem>(Main::PIPELINE_QUEUE_SIZE)
+		};
+		std::array<PipelineStage, 5u> stages{
+			PipelineStage{ "" }, PipelineStage{ "" }, PipelineStage{ "" },
+			PipelineStage{ "" }, PipelineStage{ "" }
+		};
 
-					Main::PrintDelimiter(std::cout);
+		const std::array<std::function<void(PipelineItem&)>, 4u> work{
+			[this](PipelineItem& item) {
+				this->CheckStreamable(item.filePath);
 
+				if (Main::IsJsonFile(item.filePath)) {
+					if (std::ifstream file(item.filePath, std::ios_base::in | std::ios_base::binary); file.is_open()) {
+						item.text.emplace(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+					}
+				}
+			},
+			[this](PipelineItem& item) {
+				if (this->IsStreamed() && Main::IsCsvFile(item.filePath)) {
+					return;
+				}
+
+				if (item.text.has_value()) {
+					item.dataGetter = this->MakeJsonDataGetter(std::move(*item.text));
+					item.text.reset();
+				}
+				else {
+					std::fstream file;
+					item.dataGetter = this->MakeDataGetter(item.filePath, file);
+				}
+			},
+			[this](PipelineItem& item) {
+				if (this->IsStreamed() && Main::IsCsvFile(item.filePath)) {
+					std::ostringstream out;
+					this->SolveCsvStream(item.filePath, out);
+
+					item.formatter = [output = std::move(out).str()](std::ostream& out) { out << output; };
+					return;
+				}
+
+				item.formatter = this->PrepareDataGetter(item.filePath, *item.dataGetter);
+			},
+			[](PipelineItem& item) {
+				std::ostringstream out;
+				item.formatter(out);
+				item.output = std::move(out).str();
+				item.formatter = nullptr;
+				item.dataGetter.reset();
+			}
+		};
+
+		const auto wallBegin = std::chrono::steady_clock::now();
+
+		std::vector<std::thread> threads;
+		threads.emplace_back([this, &queues, &stages, &work] {
+			for (const auto& filePath : this->filePaths_) {
+				PipelineItem item{ .filePath = filePath };
+				Main::RunPipelineStage(stages[0u], work[0u], item);
+
+				if (!queues[0u].Push(std::move(item))) {
+					break;
 				}
 			}
+
+			queues[0u].Close();
+		});
+
+		for (auto stage = 1u; stage < work.size(); ++stage) {
+			threads.emplace_back([&queues, &stages, &work, stage] {
+				while (auto item = queues[stage - 1u].Pop()) {
+					Main::RunPipelineStage(stages[stage], work[stage], *item);
+
+					if (!queues[stage].Push(std::move(*item))) {
+						break;
+					}
+				}
+
+				queues[stage].Close();
+			});
 		}
 
-		return EXIT_SUCCESS;
+		std::exception_ptr error;
+
+		while (auto item = queues.back().Pop()) {
+			if (item->error) {
+				error = item->error;
+				std::ranges::for_each(queues, [](auto& queue) { queue.Close(); });
+				break;
+			}
+
+			const auto begin = std::chrono::steady_clock::now();
+			this->WriteOutput(item->output);
+			stages.back().busy += std::chrono::steady_clock::now() - begin;
+		}
+
+		std::ranges::for_each(threads, [](auto& thread) { thread.join(); });
+
+		if (error) {
+			std::rethrow_exception(error);
+		}
+
+		const auto wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallBegin).count();
+
+		for (auto stage = 0u; stage < stages.size(); ++stage) {
+			fmt::print(stderr, " {}:  {:.1f}%", stages[stage].name,
+				100.0 * std::chrono::duration<double>(stages[stage].busy).count() / wall);
+
+			if (stage < queues.size()) {
+				const auto statistics = queues[stage].GetStatistics();
+				const auto averageDepth = statistics.pushCount == 0u ? 0.0 : static_cast<double>(statistics.depthSum) / static_cast<double>(statistics.pushCount);
+
+				fmt::print(stderr, ",  {:.2f}/{} (. {}),   {:.3f} ",
+					averageDepth, queues[stage].GetCapacity(), statistics.maxDepth, std::chrono::duration<double>(statistics.fullWait).count());
+			}
+
+			fmt::print(stderr, "\n");
+		}
+
+		const auto counters = CriticalValueCache::GetInstance().GetCounters();
+		fmt::print(stderr, "  :  {},  {}\n", counters.hits, counters.misses);
 	}
 
-private:
-	static void SetLocale(unsigned code) {
-		#if defined(_WIN32)
-			SetConsoleCP(code);
-			SetConsoleOutputCP(code);
-		#endif
+	static void RunPipelineStage(PipelineStage& stage, const std::function<void(PipelineItem&)>& work, PipelineItem& item) {
+		if (item.error) {
+			return;
+		}
+
+		const auto begin = std::chrono::steady_clock::now();
+
+		try {
+			work(item);
+		}
+		catch (const std::exception& exception) {
+			item.error = std::make_exception_ptr(std::runtime_error(item.filePath + ": " + exception.what()));
+		}
+		catch (...) {
+			item.error = std::current_exception();
+		}
+
+		stage.busy += std::chrono::steady_clock::now() - begin;
+	}
+
+	[[nodiscard]] std::function<void(std::ostream&)> PrepareDataGetter(const std::string& filePath, const IDataGetter& dataGetter) const {
+		if (this->convert_ || this->snapshot_ || this->window_ > 0 || this->halfLife_ > 0.0) {
+			std::ostringstream out;
+			this->SolveDataGetter(filePath, dataGetter, out);
+
+			return [output = std::move(out).str()](std::ostream& out) { out << output; };
+		}
+
+		Main::CheckColumnCount(dataGetter.GetColumnNames());
+		Main::CheckRowCount(dataGetter.GetRowCount(), dataGetter.GetColumnNames());
+
+		switch (dataGetter.GetColumnNames().size()) {
+		case 3u:
+			return this->PrepareFile<3>(filePath, dataGetter);
+		case 4u:
+			return this->PrepareFile<4>(filePath, dataGetter);
+		default:
+			return this->PrepareFile<Dynamic>(filePath, dataGetter);
+		}
+	}
+
+	template <int P>
+	[[nodiscard]] std::function<void(std::ostream&)> PrepareFile(const std::string& filePath, const IDataGetter& dataGetter) const {
+		if (this->stream_) {
+			const auto solver = std::make_shared<StreamingSolver<P>>(static_cast<Eigen::Index>(dataGetter.GetColumnNames().size()));
+			solver->UpdateChunked(dataGetter.GetData(), dataGetter.GetRowCount(), this->chunkRows_);
+			this->PrepareSolution(*solver);
+
+			return [this, solver, filePath, &dataGetter](std::ostream& out) {
+				this->WriteSolution(out, *solver, filePath, dataGetter.GetColumnNames(), dataGetter.GetFreedom());
+			};
+		}
+
+		const auto solver = std::make_shared<MathSolver<P>>(dataGetter.GetData(), dataGetter.GetRowCount());
+		this->PrepareSolution(*solver);
+
+		return [this, solver, filePath, &dataGetter](std::ostream& out) {
+			this->WriteSolution(out, *solver, filePath, dataGetter.GetColumnNames(), dataGetter.GetFreedom());
+		};
+	}
+
+	template <class Solver>
+	void PrepareSolution(const Solver& solver) const {
+		if constexpr (requires { solver.NormalizedMatrix(); }) {
+			if (this->full_) {
+				static_cast<void>(solver.NormalizedMatrix());
+			}
+		}
+
+		static_cast<void>(solver.GetXi());
+		static_cast<void>(solver.GetAllFStatistics());
+		static_cast<void>(solver.GetTCriteria());
+	}
+
+	void SolveFilePath(const std::string& filePath, std::ostream& out) const {
+		try {
+			this->CheckStreamable(filePath);
+
+			if (this->IsStreamed() && Main::IsCsvFile(filePath)) {
+				this->SolveCsvStream(filePath, out);
+				return;
+			}
+
+			std::fstream file;
+			const auto dataGetter = this->MakeDataGetter(filePath, file);
+
+			this->SolveDataGetter(filePath, *dataGetter, out);
+		}
+		catch (const std::exception& exception) {
+			throw std::runtime_error(filePath + ": " + exception.what());
+		}
+	}
+
+	[[nodiscard]] bool IsStreamed() const {
+		return this->stream_ && !this->convert_ && this->window_ == 0 && this->halfLife_ == 0.0;
+	}
+
+	void CheckStreamable(const std::string& filePath) const {
+		if (this->IsStreamed() && !Main::IsCsvFile(filePath)
+			&& std::filesystem::path(filePath).extension() != ColumnarFormat::EXTENSION_STR) {
+			throw std::invalid_argument("streaming mode reads only CSV/TSV and .dmc inputs; convert other inputs with --convert first");
+		}
+	}
+
+	void SolveCsvStream(const std::string& filePath, std::ostream& out) const {
+		const auto reader = std::make_unique<CsvChunkReader>(filePath, this->freedom_);
+
+		if (this->snapshot_) {
+			const auto solver = std::make_unique<StreamingSolver<>>(static_cast<Eigen::Index>(reader->GetColumnNames().size()));
+			reader->ForEachChunk<StreamingSolver<>::DataMatrix>(this->chunkRows_, [&solver](const auto& chunk) { solver->Update(chunk); });
+
+			Main::WriteSnapshot(filePath, *solver, reader->GetFreedom(), reader->GetColumnNames());
+			return;
+		}
+
+		Main::CheckColumnCount(reader->GetColumnNames());
+
+		switch (reader->GetColumnNames().size()) {
+		case 3u:
+			this->SolveCsvStream<3>(filePath, *reader, out);
+			break;
+		case 4u:
+			this->SolveCsvStream<4>(filePath, *reader, out);
+			break;
+		default:
+			this->SolveCsvStream<Dynamic>(filePath, *reader, out);
+			break;
+		}
+	}
+
+	template <int P>
+	void SolveCsvStream(const std::string& filePath, const CsvChunkReader& reader, std::ostream& out) const {
+		const auto solver = std::make_unique<StreamingSolver<P>>(static_cast<Eigen::Index>(reader.GetColumnNames().size()));
+		reader.ForEachChunk<typename StreamingSolver<P>::DataMatrix>(this->chunkRows_, [&solver](const auto& chunk) { solver->Update(chunk); });
+		Main::CheckRowCount(solver->GetRowCount(), reader.GetColumnNames());
+
+		this->WriteSolution(out, *solver, filePath, reader.GetColumnNames(), reader.GetFreedom());
+	}
+
+	static void CheckColumnCount(const std::vector<std::string>& columnNames) {
+		if (columnNames.size() < 2u) {
+			throw std::invalid_argument("the input is missing or has fewer than two columns x1, x2");
+		}
+	}
+
+	static void CheckRowCount(const Eigen::Index rowCount, const std::vector<std::string>& columnNames) {
+		if (static_cast<std::size_t>(rowCount) < columnNames.size()) {
+			throw std::invalid_argument(fmt::format("the input has {} rows, fewer than its {} columns", rowCount, columnNames.size()));
+		}
+	}
+
+	void SolveDataGetter(const std::string& filePath, const IDataGetter& dataGetter, std::ostream& out) const {
+		if (this->convert_) {
+			ColumnarFormat::Write(std::filesystem::path(filePath).replace_extension(ColumnarFormat::EXTENSION_STR).string(), dataGetter);
+			return;
+		}
+
+		if (this->snapshot_) {
+			this->WriteSnapshot(filePath, dataGetter);
+			return;
+		}
+
+		Main::CheckColumnCount(dataGetter.GetColumnNames());
+		Main::CheckRowCount(dataGetter.GetRowCount(), dataGetter.GetColumnNames());
+
+		if (this->window_ > 0) {
+			switch (dataGetter.GetColumnNames().size()) {
+			case 3u:
+				this->SolveRolling<3>(dataGetter, out);
+				break;
+			case 4u:
+				this->SolveRolling<4>(dataGetter, out);
+				break;
+			default:
+				this->SolveRolling<Dynamic>(dataGetter, out);
+				break;
+			}
+
+			return;
+		}
+
+		if (this->halfLife_ > 0.0) {
+			switch (dataGetter.GetColumnNames().size()) {
+			case 3u:
+				this->SolveEwma<3>(dataGetter, out);
+				break;
+			case 4u:
+				this->SolveEwma<4>(dataGetter, out);
+				break;
+			default:
+				this->SolveEwma<Dynamic>(dataGetter, out);
+				break;
+			}
+
+			return;
+		}
+
+		switch (dataGetter.GetColumnNames().size()) {
+		case 3u:
+			this->SolveFile<3>(filePath, dataGetter, out);
+			break;
+		case 4u:
+			this->SolveFile<4>(filePath, dataGetter, out);
+			break;
+		default:
+			this->SolveFile<Dynamic>(filePath, dataGetter, out);
+			break;
+		}
 	}
 
-	static void PrintDelimiter(std::ostream& out, const char symbol = '-', const size_t count = 40u) {
-		out << std::string(count, symbol) << '\n';
+	template <int P>
+	void SolveFile(const std::string& filePath, const IDataGetter& dataGetter, std::ostream& out) const {
+		if (this->stream_) {
+			const auto solver = std::make_unique<StreamingSolver<P>>(static_cast<Eigen::Index>(dataGetter.GetColumnNames().size()));
+			solver->UpdateChunked(dataGetter.GetData(), dataGetter.GetRowCount(), this->chunkRows_);
+
+			this->WriteSolution(out, *solver, filePath, dataGetter.GetColumnNames(), dataGetter.GetFreedom());
+		}
+		else {
+			this->WriteSolution(out, *std::make_unique<MathSolver<P>>(dataGetter.GetData(), dataGetter.GetRowCount()),
+				filePath, dataGetter.GetColumnNames(), dataGetter.GetFreedom());
+		}
+	}
+
+	template <int P>
+	void SolveRolling(const IDataGetter& dataGetter, std::ostream& out) const {
+		const auto& columnNames = dataGetter.GetColumnNames();
+
+		fmt::memory_buffer buffer;
+		Main::FormatRowHeader(buffer, columnNames);
+
+		auto rollingSolver = std::make_unique<RollingSolver<P>>(dataGetter.GetData(), dataGetter.GetRowCount(),
+			static_cast<Eigen::Index>(columnNames.size()), this->window_, this->step_);
+		rollingSolver->Run([&out, &buffer](const Eigen::Index begin, const IncrementalSolver<P>& solver) {
+			Main::FormatRow(out, buffer, begin, solver);
+		});
+
+		Main::FlushBuffer(out, buffer, true);
+	}
+
+	template <int P>
+	void SolveEwma(const IDataGetter& dataGetter, std::ostream& out) const {
+		const auto& columnNames = dataGetter.GetColumnNames();
+		const auto columnCount = static_cast<Eigen::Index>(columnNames.size());
+		const Eigen::Map<const typename EwmaSolver<P>::DataMatrix> xMatrix(dataGetter.GetData().data(), dataGetter.GetRowCount(), columnCount);
+
+		fmt::memory_buffer buffer;
+		Main::FormatRowHeader(buffer, columnNames);
+
+		const auto solver = std::make_unique<EwmaSolver<P>>(columnCount, this->halfLife_);
+
+		for (auto i = Eigen::Index{}; i < xMatrix.rows(); ++i) {
+			solver->AppendRow(xMatrix.row(i));
+
+			if ((i + 1) % this->step_ == 0 || i + 1 == xMatrix.rows()) {
+				Main::FormatRow(out, buffer, i, *solver);
+			}
+		}
+
+		Main::FlushBuffer(out, buffer, true);
+	}
+
+	static void FormatRowHeader(fmt::memory_buffer& buffer, const std::vector<std::string>& columnNames) {
+		fmt::format_to(std::back_inserter(buffer), "row\tdet\txi");
+
+		for (const auto& name : columnNames) {
+			fmt::format_to(std::back_inserter(buffer), "\tF {}", name);
+		}
+		for (auto i = 0u; i < columnNames.size(); ++i) {
+			for (auto j = i + 1u; j < columnNames.size(); ++j) {
+				fmt::format_to(std::back_inserter(buffer), "\tr {} {}", columnNames[i], columnNames[j]);
+			}
+		}
+
+		buffer.push_back('\n');
+	}
+
+	template <class Solver>
+	static void FormatRow(std::ostream& out, fmt::memory_buffer& buffer, const Eigen::Index row, const Solver& solver) {
+		const auto columnCount = solver.GetColumnCount();
+
+		fmt::format_to(std::back_inserter(buffer), "{}\t{:.6g}\t{:.6g}", row, solver.CorrelationDeterminant(), solver.GetXi());
+
+		if (solver.IsInvertible()) {
+			const auto fStatistics = solver.GetAllFStatistics();
+			const auto partialCorrelation = solver.PartialCorrelationMatrix();
+
+			for (auto i = Eigen::Index{}; i < columnCount; ++i) {
+				fmt::format_to(std::back_inserter(buffer), "\t{:.6g}", fStatistics(i));
+			}
+			for (auto i = Eigen::Index{}; i < columnCount; ++i) {
+				for (auto j = i + 1; j < columnCount; ++j) {
+					fmt::format_to(std::back_inserter(buffer), "\t{:.6g}", partialCorrelation(i, j));
+				}
+			}
+		}
+		else {
+			for (auto i = Eigen::Index{}; i < columnCount * (columnCount + 1) / 2; ++i) {
+				fmt::format_to(std::back_inserter(buffer), "\tnan");
+			}
+		}
+
+		buffer.push_back('\n');
+		Main::FlushBuffer(out, buffer, false);
+	}
+
+	static void FlushBuffer(std::ostream& out, fmt::memory_buffer& buffer, const bool force) {
+		if (force || buffer.size() >= Main::ROW_BUFFER_SIZE) {
+			out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+			buffer.clear();
+		}
+
+		if (force) {
+			out.flush();
+		}
+	}
+
+	void WriteSnapshot(const std::string& filePath, const IDataGetter& dataGetter) const {
+		const auto solver = std::make_unique<StreamingSolver<>>(static_cast<Eigen::Index>(dataGetter.GetColumnNames().size()));
+		solver->UpdateChunked(dataGetter.GetData(), dataGetter.GetRowCount(), this->chunkRows_);
+
+		Main::WriteSnapshot(filePath, *solver, dataGetter.GetFreedom(), dataGetter.GetColumnNames());
+	}
+
+	static void WriteSnapshot(const std::string& filePath, const StreamingSolver<>& solver, const double freedom,
+		const std::vector<std::string>& columnNames) {
+		MomentsSnapshot(solver.GetMoments(), freedom, columnNames)
+			.Write(std::filesystem::path(filePath).replace_extension(MomentsSnapshot::EXTENSION_STR).string());
+	}
+
+	void SolveSnapshots() const {
+		std::vector<MomentsSnapshot> snapshots;
+		snapshots.reserve(this->filePaths_.size());
+
+		std::ranges::transform(this->filePaths_, std::back_inserter(snapshots), [](const auto& filePath) {
+			return MomentsSnapshot::Read(filePath);
+		});
+
+		const auto snapshot = MomentsSnapshot::MergeAll(std::move(snapshots));
+		Main::CheckColumnCount(snapshot.GetColumnNames());
+		Main::CheckRowCount(snapshot.GetMoments().GetCount(), snapshot.GetColumnNames());
+
+		switch (snapshot.GetColumnNames().size()) {
+		case 3u:
+			this->SolveSnapshot<3>(snapshot, this->GetOutput());
+			break;
+		case 4u:
+			this->SolveSnapshot<4>(snapshot, this->GetOutput());
+			break;
+		default:
+			this->SolveSnapshot<Dynamic>(snapshot, this->GetOutput());
+			break;
+		}
+	}
+
+	template <int P>
+	void SolveSnapshot(const MomentsSnapshot& snapshot, std::ostream& out) const {
+		const auto& moments = snapshot.GetMoments();
+		const auto solver = std::make_unique<StreamingSolver<P>>(Moments<P>(moments.GetCount(), moments.GetMeans(), moments.GetCoMoments()));
+
+		std::string source;
+
+		for (const auto& filePath : this->filePaths_) {
+			source += (source.empty() ? "" : "+") + filePath;
+		}
+
+		this->WriteSolution(out, *solver, source, snapshot.GetColumnNames(), snapshot.GetFreedom());
+	}
+
+	template <class Solver>
+	void WriteSolution(std::ostream& out, const Solver& solver, const std::string& source,
+		const std::vector<std::string>& columnNames, const double freedom) const {
+		if (!this->resultWriter_) {
+			this->PrintSolution(out, solver, columnNames, freedom);
+			return;
+		}
+
+		fmt::memory_buffer buffer;
+		this->resultWriter_->WriteRecord(buffer, this->MakeRecord(solver, source, columnNames, freedom));
+
+		out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+	}
+
+	template <class Solver>
+	[[nodiscard]] ResultRecord MakeRecord(const Solver& solver, const std::string& source,
+		const std::vector<std::string>& columnNames, const double freedom) const {
+		ResultRecord record;
+		record.source = source;
+		record.columnNames = columnNames;
+		record.rowCount = solver.GetRowCount();
+		record.freedom = freedom;
+
+		record.sums = solver.GetSums().transpose();
+		record.squareSums = solver.GetSquareSums().transpose();
+		record.correlation = solver.CorrelationMatrix();
+		record.determinant = solver.CorrelationDeterminant();
+
+		const auto pairCount = static_cast<unsigned>(columnNames.size() * (columnNames.size() - 1u) / 2u);
+		record.xi = solver.GetXi();
+		record.xiCritical = PearsonTable::GetInstance().GetElement(1.0 - freedom, pairCount);
+
+		if (record.xi > record.xiCritical && solver.IsInvertible()) {
+			const auto rowCount = static_cast<double>(solver.GetRowCount());
+			const auto columnCount = static_cast<double>(columnNames.size());
+
+			record.cMatrix = solver.CMatrix();
+			record.fStatistics = solver.GetAllFStatistics();
+
+			if (rowCount <= columnCount) {
+				return record;
+			}
+
+			record.fCritical = std::make_unique<FisherF>(rowCount - columnCount, columnCount - 1.0)->GetFStatistics(1.0 - freedom);
+
+			if ((record.fStatistics.array() > record.fCritical).all()) {
+				record.determination = solver.GetAllDetermination();
+				record.partialCorrelation = solver.PartialCorrelationMatrix();
+				record.tCriteria = solver.GetTCriteria();
+
+				const auto studentT = std::make_unique<StudentT>(rowCount - columnCount);
+				const auto test = studentT->Test(record.tCriteria, 1.0 - freedom, this->adjustment_,
+					this->jobs_ > 1u ? 1u : std::thread::hardware_concurrency());
+
+				record.tCritical = studentT->GetTStatistics(1.0 - freedom);
+				record.pValues = test.pValues;
+				record.significantCount = static_cast<double>(test.significantCount);
+			}
+		}
+
+		return record;
+	}
+
+	template <class Solver>
+	void PrintSolution(std::ostream& out, const Solver& solver, const std::vector<std::string>& columnNames, const double freedom) const {
+		fmt::memory_buffer buffer;
+		auto inserter = std::back_inserter(buffer);
+
+		if constexpr (requires { solver.GetAllData(); }) {
+			if (this->full_) {
+				Main::FormatMatrix(buffer, solver.GetAllData());
+				Main::FormatDelimiter(buffer);
+			}
+		}
+
+		for (auto i = 0u; i < columnNames.size(); ++i) {
+			fmt::format_to(inserter, "Sum {0}: {1:.4f}\tSum {0}^2: {2:.4f}\n",
+				columnNames[i], solver.GetSum(i), solver.GetSquareSum(i));
+		}
+
+		Main::FormatDelimiter(buffer);
+
+		if constexpr (requires { solver.NormalizedMatrix(); }) {
+			if (this->full_) {
+				Main::FormatMatrix(buffer, solver.NormalizedMatrix());
+				Main::FormatDelimiter(buffer);
+			}
+		}
+
+		Main::FormatMatrix(buffer, solver.CorrelationMatrix());
+		Main::FormatDelimiter(buffer);
+
+		fmt::format_to(inserter, " R: {:.4f}\n", solver.CorrelationDeterminant());
+
+		const auto pairCount = static_cast<unsigned>(columnNames.size() * (columnNames.size() - 1u) / 2u);
+		auto [xi_, xit] = std::make_tuple(solver.GetXi(), PearsonTable::GetInstance().GetElement(1.0 - freedom, pairCount));
+
+		fmt::format_to(inserter, " Xi: {:.4f}\n", xi_);
+		fmt::format_to(inserter, "  Xi: {:.4f}\n", xit);
+
+		Main::FormatDelimiter(buffer);
+
+		if (xi_ > xit) {
+			if (!solver.IsInvertible()) {
+				fmt::format_to(inserter, " R :   C  \n");
+
+				out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+				return;
+			}
+
+			Main::FormatMatrix(buffer, solver.CMatrix());
+			Main::FormatDelimiter(buffer);
+
+			const auto fStatistics = solver.GetAllFStatistics();
+			const auto rowCount = static_cast<double>(solver.GetRowCount());
+			const auto columnCount = static_cast<double>(columnNames.size());
+
+			for (auto i = 0u; i < columnNames.size(); ++i) {
+				fmt::format_to(inserter, "F- {}: {:.4f}\n", columnNames[i], fStatistics(i));
+			}
+
+			Main::FormatDelimiter(buffer);
+
+			if (rowCount <= columnCount) {
+				fmt::format_to(inserter, "   F-: {}  {} \n", solver.GetRowCount(), columnNames.size());
+
+				out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+				return;
+			}
+
+			const auto f = std::make_unique<FisherF>(rowCount - columnCount, columnCount - 1.0)->GetFStatistics(1.0 - freedom);
+
+			fmt::format_to(inserter, "  F: {:.4f}\n", f);
+
+			if ((fStatistics.array() > f).all()) {
+				const auto determination = solver.GetAllDetermination();
+
+				for (auto i = 0u; i < columnNames.size(); ++i) {
+					fmt::format_to(inserter, "  {}: {:.4f}\n", columnNames[i], determination(i));
+				}
+
+				Main::FormatDelimiter(buffer);
+
+				Main::FormatMatrix(buffer, solver.PartialCorrelationMatrix());
+				Main::FormatDelimiter(buffer);
+
+				Main::FormatMatrix(buffer, solver.GetTCriteria());
+				Main::FormatDelimiter(buffer);
+
+				const auto studentT = std::make_unique<StudentT>(rowCount - columnCount);
+				const auto test = studentT->Test(solver.GetTCriteria(), 1.0 - freedom, this->adjustment_,
+					this->jobs_ > 1u ? 1u : std::thread::hardware_concurrency());
+
+				fmt::format_to(inserter, "  t: {:.4f}\n", studentT->GetTStatistics(1.0 - freedom));
+
+				Main::FormatMatrix(buffer, test.pValues);
+				Main::FormatDelimiter(buffer);
+
+				fmt::format_to(inserter, "  : {}  {}\n", test.significantCount, pairCount);
+
+				Main::FormatDelimiter(buffer);
+			}
+		}
+
+		out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+	}
+
+	template <class Matrix>
+	static void FormatMatrix(fmt::memory_buffer& buffer, const Eigen::DenseBase<Matrix>& matrix) {
+		auto width = std::size_t{};
+
+		for (auto j = Eigen::Index{}; j < matrix.cols(); ++j) {
+			for (auto i = Eigen::Index{}; i < matrix.rows(); ++i) {
+				width = std::max(width, fmt::formatted_size("{:.6g}", matrix(i, j)));
+			}
+		}
+
+		for (auto i = Eigen::Index{}; i < matrix.rows(); ++i) {
+			for (auto j = Eigen::Index{}; j < matrix.cols(); ++j) {
+				if (j != 0) {
+					buffer.push_back(' ');
+				}
+
+				fmt::format_to(std::back_inserter(buffer), "{:>{}.6g}", matrix(i, j), width);
+			}
+
+			if (i + 1 != matrix.rows()) {
+				buffer.push_back('\n');
+			}
+		}
+
+		buffer.push_back('\n');
+	}
+
+	static void FormatDelimiter(fmt::memory_buffer& buffer, const char symbol = '-', const size_t count = 40u) {
+		buffer.append(std::string(count, symbol));
+		buffer.push_back('\n');
 	}
 
 	std::vector<std::string> argv_;
 	std::vector<std::string> filePaths_;
+	std::string parser_;
+	bool convert_{};
+	double freedom_{};
+	bool stream_{};
+	Eigen::Index chunkRows_{};
+	bool snapshot_{};
+	bool merge_{};
+	Eigen::Index window_{};
+	Eigen::Index step_{};
+	double halfLife_{};
+	unsigned jobs_{};
+	bool unordered_{};
+	bool pipeline_{};
+	bool full_{};
+	MultipleTesting::Adjustment adjustment_{};
+	std::unique_ptr<IResultWriter> resultWriter_;
+	std::string outputPath_;
+	std::unique_ptr<char[]> outputBuffer_;
+	std::unique_ptr<std::ofstream> output_;
 
 	void InitArgv(int argc, char* argv[]) {
 		std::copy_n(argv, argc, std::back_inserter(this->argv_));
 	}
 
+	[[nodiscard]] int CountFileArgs() const {
+		const auto filesArg = std::ranges::find_if(this->argv_, [](const auto& arg) {
+			return arg == Main::FILES_ARG_STR.first || arg == Main::FILES_ARG_STR.second;
+		});
+
+		if (filesArg == this->argv_.end()) {
+			return 0;
+		}
+
+		const auto filesEnd = std::find_if(std::next(filesArg), this->argv_.end(), [](const auto& arg) { return arg.starts_with('-'); });
+		return static_cast<int>(std::distance(std::next(filesArg), filesEnd));
+	}
+
+	[[nodiscard]] std::unique_ptr<IDataGetter> MakeDataGetter(const std::string& filePath, std::fstream& file) const {
+		if (std::filesystem::path(filePath).extension() == ColumnarFormat::EXTENSION_STR) {
+			return std::make_unique<MmapDataGetter>(filePath);
+		}
+		if (Main::IsCsvFile(filePath)) {
+			return std::make_unique<CsvDataGetter>(filePath, this->freedom_, this->jobs_ > 1u ? 1u : std::thread::hardware_concurrency());
+		}
+		if (const auto extension = std::filesystem::path(filePath).extension(); extension == ".npy" || extension == ".npz") {
+			return std::make_unique<NpyDataGetter>(filePath, this->freedom_);
+		}
+
+		file.open(filePath, std::ios_base::in);
+
+		if (this->parser_ == Main::FAST_PARSER_STR) {
+			return std::make_unique<FastJsonDataGetter>(file);
+		}
+
+		return std::make_unique<JsonDataGetter>(file);
+	}
+
+	[[nodiscard]] std::unique_ptr<IDataGetter> MakeJsonDataGetter(std::string text) const {
+		if (this->parser_ == Main::FAST_PARSER_STR) {
+			return std::make_unique<FastJsonDataGetter>(std::move(text));
+		}
+
+		return std::make_unique<JsonDataGetter>(std::string_view(text));
+	}
+
+	[[nodiscard]] static bool IsCsvFile(const std::string& filePath) {
+		const auto extension = std::filesystem::path(filePath).extension();
+		return extension == ".csv" || extension == ".tsv";
+	}
+
+	[[nodiscard]] static bool IsJsonFile(const std::string& filePath) {
+		const auto extension = std::filesystem::path(filePath).extension();
+
+		return extension != ColumnarFormat::EXTENSION_STR && extension != ".csv" && extension != ".tsv"
+			&& extension != ".npy" && extension != ".npz";
+	}
+
 	void ParseArgs() {
 		try {
 			const auto argumentParser = std::make_unique<argparse::ArgumentParser>();
 			argumentParser->add_argument(Main::FILES_ARG_STR.first, Main::FILES_ARG_STR.second)
 				.required()
-				.nargs(static_cast<int>(this->argv_.size()) - 2)
-				.help("specify the input JSON-files.");
+				.nargs(this->CountFileArgs())
+				.help("specify the input files: JSON, CSV/TSV, NumPy (.npy/.npz) or binary columnar (.dmc).");
+			argumentParser->add_argument(Main::PARSER_ARG_STR.first, Main::PARSER_ARG_STR.second)
+				.default_value(std::string(Main::SAX_PARSER_STR))
+				.help("specify the JSON parser: sax or fast.");
+			argumentParser->add_argument(Main::CONVERT_ARG_STR.first, Main::CONVERT_ARG_STR.second)
+				.default_value(false)
+				.implicit_value(true)
+				.help("convert the input files to the binary columnar format instead of analyzing them.");
+			argumentParser->add_argument(Main::FREEDOM_ARG_STR.first, Main::FREEDOM_ARG_STR.second)
+				.default_value(0.95)
+				.scan<'g', double>()
+				.help("specify the freedom level for CSV/TSV and NumPy inputs.");
+			argumentParser->add_argument(Main::STREAM_ARG_STR.first, Main::STREAM_ARG_STR.second)
+				.default_value(false)
+				.implicit_value(true)
+				.help("compute the statistics from one pass over fixed-size row chunks without keeping the data matrix (CSV/TSV and .dmc inputs only).");
+			argumentParser->add_argument(Main::CHUNK_ROWS_ARG_STR.first, Main::CHUNK_ROWS_ARG_STR.second)
+				.default_value(65536)
+				.scan<'i', int>()
+				.help("specify the number of rows per chunk in streaming mode.");
+			argumentParser->add_argument(Main::SNAPSHOT_ARG_STR.first, Main::SNAPSHOT_ARG_STR.second)
+				.default_value(false)
+				.implicit_value(true)
+				.help("write the sufficient statistics of each input file to a moments snapshot (.dmm) instead of analyzing it.");
+			argumentParser->add_argument(Main::MERGE_ARG_STR.first, Main::MERGE_ARG_STR.second)
+				.default_value(false)
+				.implicit_value(true)
+				.help("treat the input files as moments snapshots of one dataset, merge them and analyze the result.");
+			argumentParser->add_argument(Main::WINDOW_ARG_STR.first, Main::WINDOW_ARG_STR.second)
+				.default_value(0)
+				.scan<'i', int>()
+				.help("specify the number of rows per window to print one result line per rolling window instead of the full analysis.");
+			argumentParser->add_argument(Main::STEP_ARG_STR.first, Main::STEP_ARG_STR.second)
+				.default_value(1)
+				.scan<'i', int>()
+				.help("specify the number of rows the rolling window slides by, or between EWMA result lines.");
+			argumentParser->add_argument(Main::HALF_LIFE_ARG_STR.first, Main::HALF_LIFE_ARG_STR.second)
+				.default_value(0.0)
+				.scan<'g', double>()
+				.help("specify the half-life in rows to print exponentially weighted results instead of the full analysis.");
+			argumentParser->add_argument(Main::JOBS_ARG_STR.first, Main::JOBS_ARG_STR.second)
+				.default_value(1)
+				.scan<'i', int>()
+				.help("specify the number of files to analyze in parallel.");
+			argumentParser->add_argument(Main::UNORDERED_ARG_STR.first, Main::UNORDERED_ARG_STR.second)
+				.default_value(false)
+				.implicit_value(true)
+				.help("print the results of parallel jobs as they finish instead of in input order.");
+			argumentParser->add_argument(Main::PIPELINE_ARG_STR.first, Main::PIPELINE_ARG_STR.second)
+				.default_value(false)
+				.implicit_value(true)
+				.help("read, parse, analyze, format and write the files in overlapping stages and report the stage occupancy.");
+			argumentParser->add_argument(Main::FULL_ARG_STR.first, Main::FULL_ARG_STR.second)
+				.default_value(false)
+				.implicit_value(true)
+				.help("also print the input data matrix and the normalized matrix.");
+			argumentParser->add_argument(Main::ADJUST_ARG_STR.first, Main::ADJUST_ARG_STR.second)
+				.default_value(std::string(Main::NONE_ADJUSTMENT_STR))
+				.help("specify the multiple-testing adjustment of the partial correlation p-values: none, holm or bh.");
+			argumentParser->add_argument(Main::FORMAT_ARG_STR.first, Main::FORMAT_ARG_STR.second)
+				.default_value(std::string(Main::TEXT_FORMAT_STR))
+				.help("specify the result format: text, jsonl, csv or binary (one record per input file).");
+			argumentParser->add_argument(Main::OUTPUT_ARG_STR.first, Main::OUTPUT_ARG_STR.second)
+				.default_value(std::string())
+				.help("write the results to the file instead of the console.");
 
 			argumentParser->parse_args(this->argv_);
 
 			this->filePaths_ = argumentParser->get<std::vector<std::string>>(Main::FILES_ARG_STR.first);
+			this->parser_ = argumentParser->get<std::string>(Main::PARSER_ARG_STR.first);
+			this->convert_ = argumentParser->get<bool>(Main::CONVERT_ARG_STR.first);
+			this->freedom_ = argumentParser->get<double>(Main::FREEDOM_ARG_STR.first);
+			this->stream_ = argumentParser->get<bool>(Main::STREAM_ARG_STR.first);
+			this->chunkRows_ = argumentParser->get<int>(Main::CHUNK_ROWS_ARG_STR.first);
+			this->snapshot_ = argumentParser->get<bool>(Main::SNAPSHOT_ARG_STR.first);
+			this->merge_ = argumentParser->get<bool>(Main::MERGE_ARG_STR.first);
+			this->window_ = argumentParser->get<int>(Main::WINDOW_ARG_STR.first);
+			this->step_ = argumentParser->get<int>(Main::STEP_ARG_STR.first);
+			this->halfLife_ = argumentParser->get<double>(Main::HALF_LIFE_ARG_STR.first);
+			this->unordered_ = argumentParser->get<bool>(Main::UNORDERED_ARG_STR.first);
+			this->pipeline_ = argumentParser->get<bool>(Main::PIPELINE_ARG_STR.first);
+			this->full_ = argumentParser->get<bool>(Main::FULL_ARG_STR.first);
+
+			if (const auto adjustment = argumentParser->get<std::string>(Main::ADJUST_ARG_STR.first); adjustment == Main::NONE_ADJUSTMENT_STR) {
+				this->adjustment_ = MultipleTesting::Adjustment::NONE;
+			}
+			else if (adjustment == Main::HOLM_ADJUSTMENT_STR) {
+				this->adjustment_ = MultipleTesting::Adjustment::HOLM;
+			}
+			else if (adjustment == Main::BH_ADJUSTMENT_STR) {
+				this->adjustment_ = MultipleTesting::Adjustment::BENJAMINI_HOCHBERG;
+			}
+			else {
+				throw std::invalid_argument("unknown adjustment");
+			}
+
+			this->outputPath_ = argumentParser->get<std::string>(Main::OUTPUT_ARG_STR.first);
+
+			if (const auto format = argumentParser->get<std::string>(Main::FORMAT_ARG_STR.first); format == Main::JSONL_FORMAT_STR) {
+				this->resultWriter_ = std::make_unique<JsonLinesResultWriter>();
+			}
+			else if (format == Main::CSV_FORMAT_STR) {
+				this->resultWriter_ = std::make_unique<CsvResultWriter>();
+			}
+			else if (format == Main::BINARY_FORMAT_STR) {
+				if (this->outputPath_.empty()) {
+					throw std::invalid_argument("binary format requires an output file");
+				}
+
+				this->resultWriter_ = std::make_unique<BinaryResultWriter>();
+			}
+			else if (format != Main::TEXT_FORMAT_STR) {
+				throw std::invalid_argument("unknown format");
+			}
+
+			if (const auto jobs = argumentParser->get<int>(Main::JOBS_ARG_STR.first); jobs > 0) {
+				this->jobs_ = static_cast<unsigned>(jobs);
+			}
+			else {
+				throw std::invalid_argument("jobs must be positive");
+			}
+
+			if (this->window_ < 0 || this->step_ <= 0) {
+				throw std::invalid_argument("window and step must be positive");
+			}
+
+			if (this->halfLife_ < 0.0) {
+				throw std::invalid_argument("half-life must be positive");
+			}
+
+			if (this->chunkRows_ <= 0) {
+				throw std::invalid_argument("chunk rows must be positive");
+			}
+
+			if (this->parser_ != Main::SAX_PARSER_STR && this->parser_ != Main::FAST_PARSER_STR) {
+				throw std::invalid_argument("unknown parser");
+			}
 		}
 		catch (const std::exception&) {
 			throw;
@@ -146,3 +1128,20 @@ private:
 };
 
 const std::pair <const char*, const char*> Main::FILES_ARG_STR = { "-f", "--files" };
+const std::pair <const char*, const char*> Main::PARSER_ARG_STR = { "-p", "--parser" };
+const std::pair <const char*, const char*> Main::CONVERT_ARG_STR = { "-c", "--convert" };
+const std::pair <const char*, const char*> Main::FREEDOM_ARG_STR = { "-l", "--freedom" };
+const std::pair <const char*, const char*> Main::STREAM_ARG_STR = { "-s", "--stream" };
+const std::pair <const char*, const char*> Main::CHUNK_ROWS_ARG_STR = { "-r", "--chunk-rows" };
+const std::pair <const char*, const char*> Main::SNAPSHOT_ARG_STR = { "-n", "--snapshot" };
+const std::pair <const char*, const char*> Main::MERGE_ARG_STR = { "-m", "--merge" };
+const std::pair <const char*, const char*> Main::WINDOW_ARG_STR = { "-w", "--window" };
+const std::pair <const char*, const char*> Main::STEP_ARG_STR = { "-t", "--step" };
+const std::pair <const char*, const char*> Main::HALF_LIFE_ARG_STR = { "-e", "--half-life" };
+const std::pair <const char*, const char*> Main::JOBS_ARG_STR = { "-j", "--jobs" };
+const std::pair <const char*, const char*> Main::UNORDERED_ARG_STR = { "-u", "--unordered" };
+const std::pair <const char*, const char*> Main::PIPELINE_ARG_STR = { "-i", "--pipeline" };
+const std::pair <const char*, const char*> Main::FULL_ARG_STR = { "-d", "--full" };
+const std::pair <const char*, const char*> Main::ADJUST_ARG_STR = { "-a", "--adjust" };
+const std::pair <const char*, const char*> Main::FORMAT_ARG_STR = { "-x", "--format" };
+const std::pair <const char*, const char*> Main::OUTPUT_ARG_STR = { "-o", "--output" };
@@ -3,12 +3,21 @@
 #define NOMINMAX
 
 #include <iostream>
-#include <format>
 
 #include <Windows.h>
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <sstream>
 #include <iterator>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "fmt/format.h"
@@ -17,7 +26,22 @@
 #include "argparse/argparse.hpp"
 
 #include "MathSolver/MathSolver.hpp"
+#include "MathSolver/StreamingSolver.hpp"
+#include "MathSolver/MomentsSnapshot.hpp"
+#include "MathSolver/RollingSolver.hpp"
+#include "MathSolver/EwmaSolver.hpp"
 #include "DataGetter/TestDataGetter.hpp"
 #include "Table/PearsonTable.hpp"
 #include "DataGetter/JsonDataGetter.hpp"
+#include "DataGetter/FastJsonDataGetter.hpp"
+#include "DataGetter/MmapDataGetter.hpp"
+#include "DataGetter/CsvDataGetter.hpp"
+#include "DataGetter/CsvChunkReader.hpp"
+#include "DataGetter/NpyDataGetter.hpp"
 #include "Table/FisherF.hpp"
+#include "Table/StudentT.hpp"
+#include "Scheduler/WorkStealingPool.hpp"
+#include "Scheduler/BoundedQueue.hpp"
+#include "ResultWriter/JsonLinesResultWriter.hpp"
+#include "ResultWriter/CsvResultWriter.hpp"
+#include "ResultWriter/BinaryResultWriter.hpp"
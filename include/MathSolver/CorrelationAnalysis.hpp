@@ -0,0 +1,187 @@
+#pragma once
+#include "FarrarGlauber.hpp"
+
+#include <cmath>
+#include <limits>
+#include <optional>
+
+template <class Derived, int P = Dynamic>
+class CorrelationAnalysis {
+public:
+	using SquareMatrix	= Eigen::Matrix<double, P, P>;
+	using ColumnVector	= Eigen::Matrix<double, P, 1>;
+	using RowVector		= Eigen::Matrix<double, 1, P>;
+
+	struct StageCounters {
+		std::size_t normalizedMatrix{};
+		std::size_t correlationMatrix{};
+		std::size_t correlationFactorization{};
+		std::size_t cMatrix{};
+		std::size_t cMatrixDiagonal{};
+		std::size_t partialCorrelationMatrix{};
+		std::size_t tCriteria{};
+	};
+
+	[[nodiscard]] const Eigen::LLT<SquareMatrix>& CorrelationFactorization() const {
+		if (!this->correlationFactorization.has_value()) {
+			this->correlationFactorization.emplace(this->Self().CorrelationMatrix());
+			++this->stageCounters.correlationFactorization;
+		}
+
+		return *this->correlationFactorization;
+	}
+
+	[[nodiscard]] double CorrelationDeterminant() const {
+		if (!this->IsInvertible()) {
+			return 0.0;
+		}
+
+		if constexpr (CorrelationAnalysis::IS_CLOSED_FORM) {
+			return this->Self().CorrelationMatrix().determinant();
+		}
+		else {
+
+			const auto lDiagonal = this->CorrelationFactorization().matrixLLT().diagonal();
+			return lDiagonal.prod() * lDiagonal.prod();
+		}
+	}
+
+	[[nodiscard]] double LogCorrelationDeterminant() const {
+		if (!this->IsInvertible()) {
+			return -std::numeric_limits<double>::infinity();
+		}
+
+		if constexpr (CorrelationAnalysis::IS_CLOSED_FORM) {
+			return std::log(std::abs(this->CorrelationDeterminant()));
+		}
+		else {
+
+			return 2.0 * this->CorrelationFactorization().matrixLLT().diagonal().array().log().sum();
+		}
+	}
+
+	[[nodiscard]] bool IsInvertible() const {
+		return std::isfinite(this->CMatrixDiagonal().sum());
+	}
+
+	[[nodiscard]] double GetXi() const {
+		return FarrarGlauber<P>::Xi(this->Rows(), this->Cols(), this->LogCorrelationDeterminant());
+	}
+
+	[[nodiscard]] const SquareMatrix& CMatrix() const {
+		if (!this->cMatrix.has_value()) {
+			const auto size = this->Self().GetColumnCount();
+
+			if constexpr (CorrelationAnalysis::IS_CLOSED_FORM) {
+				this->cMatrix = this->Self().CorrelationMatrix().inverse();
+			}
+			else {
+				this->cMatrix = this->IsFactorizable()
+					? SquareMatrix(this->CorrelationFactorization().solve(SquareMatrix::Identity(size, size)))
+					: SquareMatrix(SquareMatrix::Constant(size, size, std::numeric_limits<double>::infinity()));
+			}
+
+			if (!CorrelationAnalysis::IsRegular(this->cMatrix->diagonal())) {
+				this->cMatrix = SquareMatrix::Constant(size, size, std::numeric_limits<double>::infinity());
+			}
+
+			++this->stageCounters.cMatrix;
+		}
+
+		return *this->cMatrix;
+	}
+
+	[[nodiscard]] const ColumnVector& CMatrixDiagonal() const {
+		if (!this->cMatrixDiagonal.has_value()) {
+			if (CorrelationAnalysis::IS_CLOSED_FORM || this->cMatrix.has_value() || !this->IsFactorizable()) {
+				this->cMatrixDiagonal = this->CMatrix().diagonal();
+			}
+			else {
+				const auto size = this->Self().GetColumnCount();
+				const SquareMatrix lInverse = this->CorrelationFactorization().matrixL().solve(SquareMatrix::Identity(size, size));
+
+				this->cMatrixDiagonal = lInverse.colwise().squaredNorm().transpose();
+
+				if (!CorrelationAnalysis::IsRegular(*this->cMatrixDiagonal)) {
+					this->cMatrixDiagonal = ColumnVector::Constant(size, std::numeric_limits<double>::infinity());
+				}
+			}
+
+			++this->stageCounters.cMatrixDiagonal;
+		}
+
+		return *this->cMatrixDiagonal;
+	}
+
+	[[nodiscard]] ColumnVector GetAllFStatistics() const {
+		return FarrarGlauber<P>::FStatistics(this->CMatrixDiagonal(), this->Rows(), this->Cols());
+	}
+
+	[[nodiscard]] ColumnVector GetAllDetermination() const {
+		return FarrarGlauber<P>::Determination(this->CMatrixDiagonal());
+	}
+
+	[[nodiscard]] const SquareMatrix& PartialCorrelationMatrix() const {
+		if (!this->partialCorrelationMatrix.has_value()) {
+			this->partialCorrelationMatrix = FarrarGlauber<P>::PartialCorrelation(this->CMatrix());
+			++this->stageCounters.partialCorrelationMatrix;
+		}
+
+		return *this->partialCorrelationMatrix;
+	}
+
+	[[nodiscard]] const SquareMatrix& GetTCriteria() const {
+		if (!this->tCriteria.has_value()) {
+			this->tCriteria = FarrarGlauber<P>::TCriteria(this->PartialCorrelationMatrix(), this->Rows(), this->Cols());
+			++this->stageCounters.tCriteria;
+		}
+
+		return *this->tCriteria;
+	}
+
+	[[nodiscard]] StageCounters GetStageCounters() const {
+		return this->stageCounters;
+	}
+
+protected:
+	static constexpr auto IS_CLOSED_FORM = P != Dynamic && P <= 4;
+	static constexpr auto PIVOT_TOLERANCE = 1e-12;
+
+	mutable StageCounters stageCounters{};
+
+	void ResetAnalysis() {
+		this->correlationFactorization.reset();
+		this->cMatrix.reset();
+		this->cMatrixDiagonal.reset();
+		this->partialCorrelationMatrix.reset();
+		this->tCriteria.reset();
+	}
+
+private:
+	mutable std::optional<Eigen::LLT<SquareMatrix>> correlationFactorization;
+	mutable std::optional<SquareMatrix> cMatrix;
+	mutable std::optional<ColumnVector> cMatrixDiagonal;
+	mutable std::optional<SquareMatrix> partialCorrelationMatrix;
+	mutable std::optional<SquareMatrix> tCriteria;
+
+	[[nodiscard]] const Derived& Self() const {
+		return static_cast<const Derived&>(*this);
+	}
+
+	[[nodiscard]] bool IsFactorizable() const {
+		return this->CorrelationFactorization().info() == Eigen::Success;
+	}
+
+	template <class Diagonal>
+	[[nodiscard]] static bool IsRegular(const Eigen::MatrixBase<Diagonal>& cDiagonal) {
+		return ((cDiagonal.array() > 0.0) && (cDiagonal.array() * CorrelationAnalysis::PIVOT_TOLERANCE < 1.0)).all();
+	}
+
+	[[nodiscard]] double Rows() const {
+		return static_cast<double>(this->Self().GetRowCount());
+	}
+
+	[[nodiscard]] double Cols() const {
+		return static_cast<double>(this->Self().GetColumnCount());
+	}
+};
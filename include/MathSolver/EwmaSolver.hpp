@@ -0,0 +1,78 @@
+#pragma once
+#include "RankOneAnalysis.hpp"
+#include "Moments.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+template <int P = Dynamic>
+class EwmaSolver : public RankOneAnalysis<EwmaSolver<P>, P> {
+public:
+	using DataMatrix	= typename Moments<P>::DataMatrix;
+	using SquareMatrix	= typename RankOneAnalysis<EwmaSolver<P>, P>::SquareMatrix;
+	using ColumnVector	= typename RankOneAnalysis<EwmaSolver<P>, P>::ColumnVector;
+	using RowVector		= typename RankOneAnalysis<EwmaSolver<P>, P>::RowVector;
+	using RowRef		= Eigen::Ref<const RowVector, 0, Eigen::InnerStride<>>;
+
+	EwmaSolver() = delete;
+
+	explicit EwmaSolver(const Eigen::Index columnCount, const double halfLife)
+		: RankOneAnalysis<EwmaSolver<P>, P>(columnCount), decay(std::exp2(-1.0 / halfLife)), means(RowVector::Zero(columnCount)) {
+		if (!(halfLife > 0.0)) {
+			throw std::invalid_argument("EwmaSolver: half-life must be positive");
+		}
+	}
+
+	void AppendRow(const RowRef& row) {
+		const auto oldWeight = this->decay * this->weight;
+
+		this->weight = oldWeight + 1.0;
+		this->squareWeight = this->decay * this->decay * this->squareWeight + 1.0;
+		++this->count;
+
+		this->delta = (row - this->means).transpose();
+		this->means += this->delta.transpose() / this->weight;
+		this->RankOneUpdate(this->decay, oldWeight / this->weight);
+	}
+
+	void AppendRows(const Eigen::Ref<const DataMatrix>& rows) {
+		for (auto i = Eigen::Index{}; i < rows.rows(); ++i) {
+			this->AppendRow(rows.row(i));
+		}
+	}
+
+	[[nodiscard]] double GetDecay() const {
+		return this->decay;
+	}
+
+	[[nodiscard]] double GetWeight() const {
+		return this->weight;
+	}
+
+	[[nodiscard]] Eigen::Index GetRowCount() const {
+		return this->count;
+	}
+
+	[[nodiscard]] double GetEffectiveRowCount() const {
+		return this->squareWeight == 0.0 ? 0.0 : this->weight * this->weight / this->squareWeight;
+	}
+
+	[[nodiscard]] Eigen::Index GetColumnCount() const {
+		return this->means.cols();
+	}
+
+	[[nodiscard]] double MathExpect(const Eigen::Index column) const {
+		return this->means(column);
+	}
+
+	[[nodiscard]] double UnbiasedVarianceEstimate(const Eigen::Index column) const {
+		return std::sqrt(this->coMoments(column, column) / this->weight);
+	}
+
+private:
+	double decay;
+	double weight{};
+	double squareWeight{};
+	Eigen::Index count{};
+	RowVector means;
+};
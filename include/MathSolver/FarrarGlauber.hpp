@@ -0,0 +1,50 @@
+#pragma once
+#include <cmath>
+#include <Eigen/Dense>
+
+using Eigen::Dynamic;
+
+template <int P = Dynamic>
+class FarrarGlauber {
+public:
+	using SquareMatrix	= Eigen::Matrix<double, P, P>;
+	using ColumnVector	= Eigen::Matrix<double, P, 1>;
+
+	FarrarGlauber() = delete;
+
+	[[nodiscard]] static double Xi(const double rows, const double cols, const double logDeterminant) {
+		return -(rows - 1.0 - 1.0 / (6 * (2.0 * cols + 5.0))) * logDeterminant;
+	}
+
+	[[nodiscard]] static ColumnVector FStatistics(const ColumnVector& cDiagonal, const double rows, const double cols) {
+		return (cDiagonal.array() - 1.0) * (rows - cols) / (cols - 1.0);
+	}
+
+	[[nodiscard]] static ColumnVector Determination(const ColumnVector& cDiagonal) {
+		return 1.0 - cDiagonal.array().inverse();
+	}
+
+	[[nodiscard]] static SquareMatrix PartialCorrelation(const SquareMatrix& cMatrix) {
+		SquareMatrix result = SquareMatrix::Zero(cMatrix.rows(), cMatrix.cols());
+
+		for (auto i = 0u; i < result.rows(); ++i) {
+			for (auto j = 0u; j < result.cols(); ++j) {
+				result(i, j) = -cMatrix(i, j) / std::pow(cMatrix(i, i) * cMatrix(j, j), 0.5);
+			}
+		}
+
+		return result;
+	}
+
+	[[nodiscard]] static SquareMatrix TCriteria(const SquareMatrix& rMatrix, const double rows, const double cols) {
+		SquareMatrix result = SquareMatrix::Zero(rMatrix.rows(), rMatrix.cols());
+
+		for (auto i = 0u; i < result.rows(); ++i) {
+			for (auto j = 0u; j < result.cols(); ++j) {
+				result(i, j) = std::abs(rMatrix(i, j)) * std::pow(rows - cols, 0.5) / std::pow(1 - rMatrix(i, j) * rMatrix(i, j), 0.5);
+			}
+		}
+
+		return result;
+	}
+};
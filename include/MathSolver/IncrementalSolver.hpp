@@ -0,0 +1,111 @@
+#pragma once
+#include "RankOneAnalysis.hpp"
+#include "Moments.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+template <int P = Dynamic>
+class IncrementalSolver : public RankOneAnalysis<IncrementalSolver<P>, P> {
+public:
+	using DataMatrix	= typename Moments<P>::DataMatrix;
+	using SquareMatrix	= typename RankOneAnalysis<IncrementalSolver<P>, P>::SquareMatrix;
+	using ColumnVector	= typename RankOneAnalysis<IncrementalSolver<P>, P>::ColumnVector;
+	using RowVector		= typename RankOneAnalysis<IncrementalSolver<P>, P>::RowVector;
+	using RowRef		= Eigen::Ref<const RowVector, 0, Eigen::InnerStride<>>;
+
+	IncrementalSolver() = delete;
+
+	explicit IncrementalSolver(const Eigen::Index columnCount)
+		: RankOneAnalysis<IncrementalSolver<P>, P>(columnCount), means(RowVector::Zero(columnCount)) {
+
+	}
+
+	explicit IncrementalSolver(const Moments<P>& moments) : IncrementalSolver(moments.GetColumnCount()) {
+		this->count = moments.GetCount();
+		this->means = moments.GetMeans();
+		this->coMoments = moments.GetCoMoments();
+		this->Refactor();
+	}
+
+	void AppendRow(const RowRef& row) {
+		++this->count;
+
+		this->delta = (row - this->means).transpose();
+		this->means += this->delta.transpose() / static_cast<double>(this->count);
+		this->RankOneUpdate(1.0, static_cast<double>(this->count - 1) / static_cast<double>(this->count));
+	}
+
+	void RemoveRow(const RowRef& row) {
+		if (this->count == 0) {
+			throw std::logic_error("IncrementalSolver: no rows to remove");
+		}
+
+		if (--this->count == 0) {
+			this->means.setZero();
+			this->coMoments.setZero();
+			this->Refactor();
+			return;
+		}
+
+		this->delta = (row - this->means).transpose();
+		this->means -= this->delta.transpose() / static_cast<double>(this->count);
+		this->RankOneUpdate(1.0, -static_cast<double>(this->count + 1) / static_cast<double>(this->count));
+	}
+
+	void AppendRows(const Eigen::Ref<const DataMatrix>& rows) {
+		for (auto i = Eigen::Index{}; i < rows.rows(); ++i) {
+			this->AppendRow(rows.row(i));
+		}
+	}
+
+	void RemoveRows(const Eigen::Ref<const DataMatrix>& rows) {
+		for (auto i = Eigen::Index{}; i < rows.rows(); ++i) {
+			this->RemoveRow(rows.row(i));
+		}
+	}
+
+	[[nodiscard]] Moments<P> GetMoments() const {
+		return Moments<P>(this->count, this->means, this->coMoments);
+	}
+
+	[[nodiscard]] Eigen::Index GetRowCount() const {
+		return this->count;
+	}
+
+	[[nodiscard]] double GetEffectiveRowCount() const {
+		return static_cast<double>(this->count);
+	}
+
+	[[nodiscard]] Eigen::Index GetColumnCount() const {
+		return this->means.cols();
+	}
+
+	[[nodiscard]] double GetSum(const Eigen::Index column) const {
+		return this->means(column) * static_cast<double>(this->count);
+	}
+
+	[[nodiscard]] double GetSquareSum(const Eigen::Index column) const {
+		return this->coMoments(column, column) + this->means(column) * this->means(column) * static_cast<double>(this->count);
+	}
+
+	[[nodiscard]] RowVector GetSums() const {
+		return this->GetMoments().GetSums();
+	}
+
+	[[nodiscard]] RowVector GetSquareSums() const {
+		return this->GetMoments().GetSquareSums();
+	}
+
+	[[nodiscard]] double MathExpect(const Eigen::Index column) const {
+		return this->means(column);
+	}
+
+	[[nodiscard]] double UnbiasedVarianceEstimate(const Eigen::Index column) const {
+		return std::sqrt(this->coMoments(column, column) / static_cast<double>(this->count));
+	}
+
+private:
+	Eigen::Index count{};
+	RowVector means;
+};
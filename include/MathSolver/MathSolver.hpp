@@ -1,223 +1,149 @@
 #pragma once
-#include <numeric>
-#include <Eigen/Dense>
-#include <vector>
+#include "CorrelationAnalysis.hpp"
 
-using Eigen::Dynamic;
-using Eigen::MatrixXd;
+#include <span>
 
+using Eigen::MatrixXd;
 
-class MathSolver {
+template <int P = Dynamic>
+class MathSolver : public CorrelationAnalysis<MathSolver<P>, P> {
 public:
+	using DataMatrix	= Eigen::Matrix<double, Dynamic, P>;
+	using SquareMatrix	= typename CorrelationAnalysis<MathSolver<P>, P>::SquareMatrix;
+	using ColumnVector	= typename CorrelationAnalysis<MathSolver<P>, P>::ColumnVector;
+	using RowVector		= typename CorrelationAnalysis<MathSolver<P>, P>::RowVector;
+	using DataMap		= Eigen::Map<const DataMatrix>;
+
 	MathSolver() = delete;
 
-	explicit MathSolver(const std::vector<double>& x1, const std::vector<double>& x2, const std::vector<double>& x3)
-		: x1(x1), x2(x2), x3(x3), x1Squared(x1.size()), x2Squared(x2.size()),
-		x3Squared(x3.size()), xMatrix(MatrixXd::Zero(std::max({ x1.size(), x2.size(), x3.size() }), 3)) {
-		this->InitMatrix();
-		this->InitSquareVectors();
+	explicit MathSolver(DataMatrix data)
+		: ownedMatrix(std::move(data)), xMatrix(this->ownedMatrix.data(), this->ownedMatrix.rows(), this->ownedMatrix.cols()) {
 		this->InitSum();
 		this->InitSquareSum();
+		this->InitStatistics();
 	}
 
-	[[nodiscard]] double GetX1Sum() const {
-		return this->x1Sum;
-	}
-
-	[[nodiscard]] double GetX2Sum() const {
-		return this->x2Sum;
+	explicit MathSolver(std::span<const double> data, const Eigen::Index rows)
+		: xMatrix(data.data(), rows, rows == 0 ? 0 : static_cast<Eigen::Index>(data.size()) / rows) {
+		this->InitSum();
+		this->InitSquareSum();
+		this->InitStatistics();
 	}
 
-	[[nodiscard]] double GetX3Sum() const {
-		return this->x3Sum;
-	}
+	MathSolver(const MathSolver&) = delete;
 
-	[[nodiscard]] double GetX1SquareSum() const {
-		return this->x1SquaredSum;
-	}
+	MathSolver(MathSolver&&) noexcept = default;
 
-	[[nodiscard]] double GetX2SquareSum() const {
-		return this->x2SquaredSum;
+	[[nodiscard]] Eigen::Index GetRowCount() const {
+		return this->xMatrix.rows();
 	}
 
-	[[nodiscard]] double GetX3SquareSum() const {
-		return this->x3SquaredSum;
+	[[nodiscard]] Eigen::Index GetColumnCount() const {
+		return this->xMatrix.cols();
 	}
 
-	[[nodiscard]] std::vector<double> GetX1Data() const {
-		return this->x1;
+	[[nodiscard]] double GetSum(const Eigen::Index column) const {
+		return this->sums(column);
 	}
 
-	[[nodiscard]] std::vector<double> GetX2Data() const {
-		return this->x2;
+	[[nodiscard]] double GetSquareSum(const Eigen::Index column) const {
+		return this->squareSums(column);
 	}
 
-	[[nodiscard]] std::vector<double> GetX3Data() const {
-		return this->x3;
+	[[nodiscard]] const RowVector& GetSums() const {
+		return this->sums;
 	}
 
-	[[nodiscard]] std::vector<double> GetX1SquareData() const {
-		return this->x1Squared;
+	[[nodiscard]] const RowVector& GetSquareSums() const {
+		return this->squareSums;
 	}
 
-	[[nodiscard]] std::vector<double> GetX2SquareData() const {
-		return this->x2Squared;
+	[[nodiscard]] std::span<const double> GetColumnData(const Eigen::Index column) const {
+		return { this->xMatrix.col(column).data(), static_cast<std::size_t>(this->xMatrix.rows()) };
 	}
 
-	[[nodiscard]] std::vector<double> GetX3SquareData() const {
-		return this->x3Squared;
+	[[nodiscard]] auto GetColumnSquareData(const Eigen::Index column) const {
+		return this->xMatrix.col(column).array().square();
 	}
 
-	[[nodiscard]] MatrixXd GetAllData() const {
+	[[nodiscard]] const DataMap& GetAllData() const {
 		return this->xMatrix;
 	}
 
-	[[nodiscard]] double MathExpectX1() const {
-		return this->x1Sum / this->x1.size();
-	}
-
-	[[nodiscard]] double MathExpectX2() const {
-		return this->x2Sum / this->x2.size();
-	}
-
-	[[nodiscard]] double MathExpectX3() const {
-		return this->x3Sum / this->x3.size();
-	}
-
-	[[nodiscard]] double UnbiasedVarianceEstimateX1() const {
-		auto result = 0.0;
-		std::ranges::for_each(this->x1, [&result, this](auto el) { result += std::pow(el - this->MathExpectX1(), 2.0); });
-		return std::pow(result / this->x1.size(), 0.5);
+	[[nodiscard]] double MathExpect(const Eigen::Index column) const {
+		return this->means(column);
 	}
 
-	[[nodiscard]] double UnbiasedVarianceEstimateX2() const {
-		auto result = 0.0;
-		std::ranges::for_each(this->x2, [&result, this](auto el) { result += std::pow(el - this->MathExpectX2(), 2.0); });
-		return std::pow(result / this->x2.size(), 0.5);
+	[[nodiscard]] double UnbiasedVarianceEstimate(const Eigen::Index column) const {
+		return this->deviations(column);
 	}
 
-	[[nodiscard]] double UnbiasedVarianceEstimateX3() const {
-		auto result = 0.0;
-		std::ranges::for_each(this->x3, [&result, this](auto el) { result += std::pow(el - this->MathExpectX3(), 2.0); });
-		return std::pow(result / this->x2.size(), 0.5);
-	}
+	[[nodiscard]] const DataMatrix& NormalizedMatrix() const {
+		if (!this->normalizedMatrix.has_value()) {
+			const auto rows = static_cast<double>(this->xMatrix.rows());
 
-	[[nodiscard]] MatrixXd NormalizedMatrix() const {
-		MatrixXd result = MatrixXd::Zero(this->xMatrix.rows(), this->xMatrix.cols());
+			DataMatrix result = this->xMatrix.rowwise() - this->means;
+			result.array().rowwise() /= this->deviations.array() * std::pow(rows, 0.5);
 
-		for (auto i = 0u; i < result.rows(); ++i) {
-			result(i, 0) = (this->xMatrix(i, 0) - this->MathExpectX1()) / this->UnbiasedVarianceEstimateX1() / std::pow(result.rows(), 0.5);
-			result(i, 1) = (this->xMatrix(i, 1) - this->MathExpectX2()) / this->UnbiasedVarianceEstimateX2() / std::pow(result.rows(), 0.5);
-			result(i, 2) = (this->xMatrix(i, 2) - this->MathExpectX3()) / this->UnbiasedVarianceEstimateX3() / std::pow(result.rows(), 0.5);
+			this->normalizedMatrix = std::move(result);
+			++this->stageCounters.normalizedMatrix;
 		}
 
-		return result;
+		return *this->normalizedMatrix;
 	}
 
-	[[nodiscard]] MatrixXd CorrelationMatrix() const {
-		const auto normalizedMatrix = this->NormalizedMatrix();
-		const auto result = normalizedMatrix.transpose() * normalizedMatrix;
-		return result;
-	}
+	[[nodiscard]] const SquareMatrix& CorrelationMatrix() const {
+		if (!this->correlationMatrix.has_value()) {
+			const auto rows = this->xMatrix.rows();
+			const auto cols = this->xMatrix.cols();
 
-	[[nodiscard]] double CorrelationDeterminant() const {
-		return this->CorrelationMatrix().determinant();
-	}
+			SquareMatrix result = SquareMatrix::Zero(cols, cols);
+			DataMatrix centered(std::min(MathSolver::BLOCK_ROWS, rows), cols);
 
-	[[nodiscard]] double GetXi() const {
-		return -(this->xMatrix.rows() - 1.0 - 1.0 / (6 * (2.0 * this->xMatrix.cols() + 5.0))) * log(abs(this->CorrelationDeterminant()));
-	}
+			for (auto begin = Eigen::Index{}; begin < rows; begin += MathSolver::BLOCK_ROWS) {
+				const auto blockRows = std::min(MathSolver::BLOCK_ROWS, rows - begin);
 
-	[[nodiscard]] MatrixXd CMatrix() const {
-		return this->CorrelationMatrix().inverse();
-	}
-
-	[[nodiscard]] std::tuple<double, double, double> GetAllFStatistics() const {
-		const auto cMatrix = this->CMatrix();
-
-		auto [x1F, x2F, x3F]
-			= std::make_tuple((cMatrix(0, 0) - 1.0) * (this->xMatrix.rows() - this->xMatrix.cols()) / (this->xMatrix.cols() - 1),
-						      (cMatrix(1, 1) - 1.0) * (this->xMatrix.rows() - this->xMatrix.cols()) / (this->xMatrix.cols() - 1),
-						      (cMatrix(2, 2) - 1.0) * (this->xMatrix.rows() - this->xMatrix.cols()) / (this->xMatrix.cols() - 1));
-
-		return std::make_tuple(x1F, x2F, x3F);
-	}
-
-	[[nodiscard]] std::tuple<double, double, double> GetAllDetermination() const {
-		const auto cMatrix = this->CMatrix();
-
-		auto [x1R, x2R, x3R]
-			= std::make_tuple(1.0 - 1.0 / cMatrix(0, 0), 1.0 - 1.0 / cMatrix(1, 1), 1.0 - 1.0 / cMatrix(2, 2));
-
-		return std::make_tuple(x1R, x2R, x3R);
-	}
-
-	[[nodiscard]] MatrixXd PartialCorrelationMatrix() const {
-		const auto cMatrix = this->CMatrix();
-		MatrixXd result = MatrixXd::Zero(cMatrix.rows(), cMatrix.cols());
-
-		for (auto i = 0u; i < result.rows(); ++i) {
-			for (auto j = 0u; j < result.cols(); ++j) {
-				result(i, j) = -cMatrix(i, j) / std::pow(cMatrix(i, i) * cMatrix(j, j), 0.5);
+				centered.topRows(blockRows) = this->xMatrix.middleRows(begin, blockRows).rowwise() - this->means;
+				result.noalias() += centered.topRows(blockRows).transpose() * centered.topRows(blockRows);
 			}
-		}
-
-		return result;
-	}
 
-	[[nodiscard]] MatrixXd GetTCriteria() const {
-		const auto rMatrix = this->PartialCorrelationMatrix();
-		MatrixXd result = MatrixXd::Zero(rMatrix.rows(), rMatrix.cols());
+			const RowVector scale = this->deviations * std::pow(static_cast<double>(rows), 0.5);
+			result.array() /= (scale.transpose() * scale).array();
 
-		for (auto i = 0u; i < result.rows(); ++i) {
-			for (auto j = 0u; j < result.cols(); ++j) {
-				result(i, j) = std::abs(rMatrix(i, j)) * std::pow(this->xMatrix.rows() - this->xMatrix.cols(), 0.5) / std::pow(1 - rMatrix(i, j) * rMatrix(i, j), 0.5);
-			}
+			this->correlationMatrix = std::move(result);
+			++this->stageCounters.correlationMatrix;
 		}
 
-		return result;
+		return *this->correlationMatrix;
 	}
 
 private:
-	std::vector<double> x1;
-	std::vector<double> x2;
-	std::vector<double> x3;
+	static constexpr auto BLOCK_ROWS = Eigen::Index{ 4096 };
 
-	double x1Sum;
-	double x2Sum;
-	double x3Sum;
+	DataMatrix ownedMatrix;
+	DataMap xMatrix;
 
-	std::vector<double> x1Squared;
-	std::vector<double> x2Squared;
-	std::vector<double> x3Squared;
+	RowVector sums;
+	RowVector squareSums;
 
-	double x1SquaredSum;
-	double x2SquaredSum;
-	double x3SquaredSum;
+	RowVector means;
+	RowVector deviations;
 
-	MatrixXd xMatrix;
+	mutable std::optional<DataMatrix> normalizedMatrix;
+	mutable std::optional<SquareMatrix> correlationMatrix;
 
-	void InitMatrix() {
-		std::ranges::for_each(this->x1, [i = 0, this](auto el) mutable { this->xMatrix(i++, 0u) = el; });
-		std::ranges::for_each(this->x2, [i = 0, this](auto el) mutable { this->xMatrix(i++, 1u) = el; });
-		std::ranges::for_each(this->x3, [i = 0, this](auto el) mutable { this->xMatrix(i++, 2u) = el; });
+	void InitSum() {
+		this->sums = this->xMatrix.colwise().sum();
 	}
 
-	void InitSquareVectors() {
-		std::ranges::for_each(this->x1, [iter = this->x1Squared.begin()](auto el) mutable { *iter++ = el * el; });
-		std::ranges::for_each(this->x2, [iter = this->x2Squared.begin()](auto el) mutable { *iter++ = el * el; });
-		std::ranges::for_each(this->x3, [iter = this->x3Squared.begin()](auto el) mutable { *iter++ = el * el; });
+	void InitSquareSum() {
+		this->squareSums = this->xMatrix.colwise().squaredNorm();
 	}
 
-	void InitSum() {
-		this->x1Sum = std::reduce(this->x1.begin(), this->x1.end(), 0.0, std::plus());
-		this->x2Sum = std::reduce(this->x2.begin(), this->x2.end(), 0.0, std::plus());
-		this->x3Sum = std::reduce(this->x3.begin(), this->x3.end(), 0.0, std::plus());
-	}
+	void InitStatistics() {
+		const auto rows = static_cast<double>(this->xMatrix.rows());
 
-	void InitSquareSum() {
-		this->x1SquaredSum = std::reduce(this->x1Squared.begin(), this->x1Squared.end(), 0.0, std::plus());
-		this->x2SquaredSum = std::reduce(this->x2Squared.begin(), this->x2Squared.end(), 0.0, std::plus());
-		this->x3SquaredSum = std::reduce(this->x3Squared.begin(), this->x3Squared.end(), 0.0, std::plus());
+		this->means = this->sums / rows;
+		this->deviations = ((this->xMatrix.rowwise() - this->means).colwise().squaredNorm() / rows).cwiseSqrt();
 	}
 };
@@ -0,0 +1,91 @@
+#pragma once
+#include <Eigen/Dense>
+
+using Eigen::Dynamic;
+
+template <int P = Dynamic>
+class Moments {
+public:
+	using DataMatrix	= Eigen::Matrix<double, Dynamic, P>;
+	using SquareMatrix	= Eigen::Matrix<double, P, P>;
+	using RowVector		= Eigen::Matrix<double, 1, P>;
+
+	Moments() = delete;
+
+	explicit Moments(const Eigen::Index columnCount)
+		: means(RowVector::Zero(columnCount)), coMoments(SquareMatrix::Zero(columnCount, columnCount)) {
+
+	}
+
+	explicit Moments(const Eigen::Index count, RowVector means, SquareMatrix coMoments)
+		: count(count), means(std::move(means)), coMoments(std::move(coMoments)) {
+
+	}
+
+	void Update(const Eigen::Ref<const DataMatrix>& chunk) {
+		if (chunk.rows() == 0) {
+			return;
+		}
+
+		const RowVector chunkMeans = chunk.colwise().mean();
+		const DataMatrix centered = chunk.rowwise() - chunkMeans;
+
+		this->Merge(chunk.rows(), chunkMeans, centered.transpose() * centered);
+	}
+
+	void Merge(const Moments& other) {
+		this->Merge(other.count, other.means, other.coMoments);
+	}
+
+	[[nodiscard]] Eigen::Index GetCount() const {
+		return this->count;
+	}
+
+	[[nodiscard]] Eigen::Index GetColumnCount() const {
+		return this->means.cols();
+	}
+
+	[[nodiscard]] const RowVector& GetMeans() const {
+		return this->means;
+	}
+
+	[[nodiscard]] const SquareMatrix& GetCoMoments() const {
+		return this->coMoments;
+	}
+
+	[[nodiscard]] RowVector GetSums() const {
+		return this->means * static_cast<double>(this->count);
+	}
+
+	[[nodiscard]] RowVector GetSquareSums() const {
+		return this->coMoments.diagonal().transpose() + this->means.cwiseAbs2() * static_cast<double>(this->count);
+	}
+
+	[[nodiscard]] RowVector GetDeviations() const {
+		return (this->coMoments.diagonal().transpose() / static_cast<double>(this->count)).cwiseSqrt();
+	}
+
+	[[nodiscard]] SquareMatrix CorrelationMatrix() const {
+		const auto scale = this->coMoments.diagonal().cwiseSqrt().eval();
+		return this->coMoments.array() / (scale * scale.transpose()).array();
+	}
+
+private:
+	Eigen::Index count{};
+	RowVector means;
+	SquareMatrix coMoments;
+
+	void Merge(const Eigen::Index otherCount, const RowVector& otherMeans, const SquareMatrix& otherCoMoments) {
+		if (otherCount == 0) {
+			return;
+		}
+
+		const auto total = this->count + otherCount;
+		const RowVector delta = otherMeans - this->means;
+
+		this->coMoments += otherCoMoments
+			+ delta.transpose() * delta * (static_cast<double>(this->count) * static_cast<double>(otherCount) / static_cast<double>(total));
+		this->means += delta * (static_cast<double>(otherCount) / static_cast<double>(total));
+		this->count = total;
+	}
+};
@@ -0,0 +1,202 @@
+#pragma once
+#include "Moments.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+static_assert(std::endian::native == std::endian::little, "moments snapshots store little-endian values");
+
+class MomentsSnapshot {
+private:
+	static constexpr std::array<char, 8u> MAGIC{ 'D', 'M', 'L', '5', 'M', 'O', 'M', '\0' };
+	static constexpr std::uint32_t VERSION = 1u;
+
+public:
+	static constexpr auto* EXTENSION_STR = ".dmm";
+
+	MomentsSnapshot() = delete;
+
+	explicit MomentsSnapshot(Moments<> moments, const double freedom, std::vector<std::string> columnNames)
+		: moments(std::move(moments)), freedom(freedom), columnNames(std::move(columnNames)) {
+
+	}
+
+	[[nodiscard]] const Moments<>& GetMoments() const {
+		return this->moments;
+	}
+
+	[[nodiscard]] double GetFreedom() const {
+		return this->freedom;
+	}
+
+	[[nodiscard]] const std::vector<std::string>& GetColumnNames() const {
+		return this->columnNames;
+	}
+
+	void Merge(const MomentsSnapshot& other) {
+		if (other.columnNames != this->columnNames || other.freedom != this->freedom) {
+			throw std::invalid_argument("MomentsSnapshot: snapshots describe different datasets");
+		}
+
+		this->moments.Merge(other.moments);
+	}
+
+	[[nodiscard]] static MomentsSnapshot MergeAll(std::vector<MomentsSnapshot> snapshots,
+		const unsigned threadCount = std::max(1u, std::thread::hardware_concurrency())) {
+		if (snapshots.empty()) {
+			throw std::invalid_argument("MomentsSnapshot: nothing to merge");
+		}
+
+		for (auto stride = std::size_t{ 1u }; stride < snapshots.size(); stride *= 2u) {
+			const auto pairCount = (snapshots.size() + 2u * stride - 1u) / (2u * stride);
+			std::atomic<std::size_t> nextPair{};
+			std::vector<std::exception_ptr> errors(threadCount);
+			std::vector<std::thread> threads;
+
+			for (auto t = 0u; t < std::min<std::size_t>(threadCount, pairCount); ++t) {
+				threads.emplace_back([&snapshots, &nextPair, &errors, pairCount, stride, t] {
+					try {
+						for (auto pair = nextPair++; pair < pairCount; pair = nextPair++) {
+							const auto left = pair * 2u * stride;
+
+							if (left + stride < snapshots.size()) {
+								snapshots[left].Merge(snapshots[left + stride]);
+							}
+						}
+					}
+					catch (...) {
+						errors[t] = std::current_exception();
+					}
+				});
+			}
+
+			std::ranges::for_each(threads, [](auto& thread) { thread.join(); });
+
+			for (const auto& error : errors) {
+				if (error) {
+					std::rethrow_exception(error);
+				}
+			}
+		}
+
+		return std::move(snapshots.front());
+	}
+
+	void Write(const std::string& path) const {
+		std::ofstream file(path, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+
+		if (!file.is_open()) {
+			throw std::runtime_error("MomentsSnapshot: cannot create " + path);
+		}
+
+		const auto columnCount = static_cast<std::uint32_t>(this->columnNames.size());
+		const auto count = static_cast<std::uint64_t>(this->moments.GetCount());
+
+		file.write(MomentsSnapshot::MAGIC.data(), MomentsSnapshot::MAGIC.size());
+		MomentsSnapshot::WriteValue(file, MomentsSnapshot::VERSION);
+		MomentsSnapshot::WriteValue(file, columnCount);
+		MomentsSnapshot::WriteValue(file, count);
+		MomentsSnapshot::WriteValue(file, this->freedom);
+
+		std::ranges::for_each(this->columnNames, [&file](const auto& name) {
+			MomentsSnapshot::WriteValue(file, static_cast<std::uint32_t>(name.size()));
+			file.write(name.data(), static_cast<std::streamsize>(name.size()));
+		});
+
+		file.write(reinterpret_cast<const char*>(this->moments.GetMeans().data()), columnCount * sizeof(double));
+		file.write(reinterpret_cast<const char*>(this->moments.GetCoMoments().data()), columnCount * columnCount * sizeof(double));
+
+		if (!file) {
+			throw std::runtime_error("MomentsSnapshot: cannot write " + path);
+		}
+	}
+
+	[[nodiscard]] static MomentsSnapshot Read(const std::string& path) {
+		std::ifstream file(path, std::ios_base::in | std::ios_base::binary);
+		std::array<char, 8u> magic{};
+
+		file.read(magic.data(), magic.size());
+
+		if (!file || magic != MomentsSnapshot::MAGIC || MomentsSnapshot::ReadValue<std::uint32_t>(file) != MomentsSnapshot::VERSION) {
+			throw std::runtime_error("MomentsSnapshot: unsupported file " + path);
+		}
+
+		const auto columnCount = MomentsSnapshot::ReadValue<std::uint32_t>(file);
+		const auto count = MomentsSnapshot::ReadValue<std::uint64_t>(file);
+		const auto freedom = MomentsSnapshot::ReadValue<double>(file);
+		const auto payloadSize = MomentsSnapshot::RemainingSize(file);
+
+		if (columnCount > payloadSize / (sizeof(std::uint32_t) + sizeof(double))
+			|| (columnCount != 0u && columnCount > payloadSize / sizeof(double) / columnCount)) {
+			throw std::runtime_error("MomentsSnapshot: truncated file " + path);
+		}
+
+		std::vector<std::string> columnNames(columnCount);
+		std::ranges::for_each(columnNames, [&file, &path](auto& name) {
+			const auto length = MomentsSnapshot::ReadValue<std::uint32_t>(file);
+
+			if (length > MomentsSnapshot::RemainingSize(file)) {
+				throw std::runtime_error("MomentsSnapshot: truncated file " + path);
+			}
+
+			name.resize(length);
+			file.read(name.data(), static_cast<std::streamsize>(name.size()));
+		});
+
+		Moments<>::RowVector means(columnCount);
+		Moments<>::SquareMatrix coMoments(columnCount, columnCount);
+
+		file.read(reinterpret_cast<char*>(means.data()), columnCount * sizeof(double));
+		file.read(reinterpret_cast<char*>(coMoments.data()), columnCount * columnCount * sizeof(double));
+
+		if (!file) {
+			throw std::runtime_error("MomentsSnapshot: truncated file " + path);
+		}
+
+		return MomentsSnapshot(Moments<>(static_cast<Eigen::Index>(count), std::move(means), std::move(coMoments)), freedom, std::move(columnNames));
+	}
+
+private:
+	Moments<> moments;
+	double freedom;
+	std::vector<std::string> columnNames;
+
+	template <class T>
+	static void WriteValue(std::ofstream& file, const T value) {
+		file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+	}
+
+	[[nodiscard]] static std::uint64_t RemainingSize(std::ifstream& file) {
+		const auto position = file.tellg();
+		file.seekg(0, std::ios_base::end);
+		const auto end = file.tellg();
+		file.seekg(position);
+
+		if (!file || end < position) {
+			throw std::runtime_error("MomentsSnapshot: truncated file");
+		}
+
+		return static_cast<std::uint64_t>(end - position);
+	}
+
+	template <class T>
+	[[nodiscard]] static T ReadValue(std::ifstream& file) {
+		T result{};
+		file.read(reinterpret_cast<char*>(&result), sizeof(T));
+
+		if (!file) {
+			throw std::runtime_error("MomentsSnapshot: truncated file");
+		}
+
+		return result;
+	}
+};
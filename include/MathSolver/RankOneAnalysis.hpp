@@ -0,0 +1,158 @@
+#pragma once
+#include "FarrarGlauber.hpp"
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+template <class Derived, int P = Dynamic>
+class RankOneAnalysis {
+public:
+	using SquareMatrix	= Eigen::Matrix<double, P, P>;
+	using ColumnVector	= Eigen::Matrix<double, P, 1>;
+	using RowVector		= Eigen::Matrix<double, 1, P>;
+
+	static constexpr std::size_t REFACTOR_INTERVAL = 1024u;
+
+	void Refactor() {
+		this->updateCount = 0u;
+		this->isInvertible = false;
+
+		if (this->Rows() <= this->Cols()) {
+			return;
+		}
+
+		this->factorization.compute(this->coMoments);
+
+		if (this->factorization.info() != Eigen::Success) {
+			return;
+		}
+
+		this->inverseCoMoments.setIdentity();
+		this->factorization.solveInPlace(this->inverseCoMoments);
+		this->logDeterminant = 2.0 * this->factorization.matrixLLT().diagonal().array().log().sum();
+		this->isInvertible = true;
+	}
+
+	[[nodiscard]] bool IsInvertible() const {
+		return this->isInvertible;
+	}
+
+	[[nodiscard]] SquareMatrix CorrelationMatrix() const {
+		const auto scale = this->Scale();
+		return this->coMoments.array() / (scale * scale.transpose()).array();
+	}
+
+	[[nodiscard]] double LogCorrelationDeterminant() const {
+		if (!this->isInvertible) {
+			return -std::numeric_limits<double>::infinity();
+		}
+
+		return this->logDeterminant - this->coMoments.diagonal().array().log().sum();
+	}
+
+	[[nodiscard]] double CorrelationDeterminant() const {
+		return std::exp(this->LogCorrelationDeterminant());
+	}
+
+	[[nodiscard]] double GetXi() const {
+		return FarrarGlauber<P>::Xi(this->Rows(), this->Cols(), this->LogCorrelationDeterminant());
+	}
+
+	[[nodiscard]] SquareMatrix CMatrix() const {
+		this->CheckInvertible();
+
+		const auto scale = this->Scale();
+		return this->inverseCoMoments.array() * (scale * scale.transpose()).array();
+	}
+
+	[[nodiscard]] ColumnVector CMatrixDiagonal() const {
+		this->CheckInvertible();
+
+		return this->inverseCoMoments.diagonal().cwiseProduct(this->coMoments.diagonal());
+	}
+
+	[[nodiscard]] ColumnVector GetAllFStatistics() const {
+		return FarrarGlauber<P>::FStatistics(this->CMatrixDiagonal(), this->Rows(), this->Cols());
+	}
+
+	[[nodiscard]] ColumnVector GetAllDetermination() const {
+		return FarrarGlauber<P>::Determination(this->CMatrixDiagonal());
+	}
+
+	[[nodiscard]] SquareMatrix PartialCorrelationMatrix() const {
+		return FarrarGlauber<P>::PartialCorrelation(this->CMatrix());
+	}
+
+	[[nodiscard]] SquareMatrix GetTCriteria() const {
+		return FarrarGlauber<P>::TCriteria(this->PartialCorrelationMatrix(), this->Rows(), this->Cols());
+	}
+
+protected:
+	SquareMatrix coMoments;
+	ColumnVector delta;
+
+	explicit RankOneAnalysis(const Eigen::Index columnCount)
+		: coMoments(SquareMatrix::Zero(columnCount, columnCount)), delta(ColumnVector::Zero(columnCount)),
+		inverseCoMoments(SquareMatrix::Zero(columnCount, columnCount)), product(ColumnVector::Zero(columnCount)),
+		factorization(columnCount) {
+
+	}
+
+	void RankOneUpdate(const double decay, const double weight) {
+		if (decay != 1.0) {
+			this->coMoments *= decay;
+			this->inverseCoMoments /= decay;
+			this->logDeterminant += this->Cols() * std::log(decay);
+		}
+
+		this->coMoments.noalias() += weight * this->delta * this->delta.transpose();
+
+		if (!this->isInvertible || ++this->updateCount >= RankOneAnalysis::REFACTOR_INTERVAL) {
+			this->Refactor();
+			return;
+		}
+
+		this->product.noalias() = this->inverseCoMoments * this->delta;
+
+		const auto denominator = 1.0 + weight * this->delta.dot(this->product);
+
+		if (denominator <= std::numeric_limits<double>::epsilon()) {
+			this->Refactor();
+			return;
+		}
+
+		this->inverseCoMoments.noalias() -= (weight / denominator) * this->product * this->product.transpose();
+		this->logDeterminant += std::log(denominator);
+	}
+
+private:
+	SquareMatrix inverseCoMoments;
+	ColumnVector product;
+	Eigen::LLT<SquareMatrix> factorization;
+	double logDeterminant{};
+	bool isInvertible{};
+	std::size_t updateCount{};
+
+	void CheckInvertible() const {
+		if (!this->isInvertible) {
+			throw std::domain_error("RankOneAnalysis: the correlation matrix is singular");
+		}
+	}
+
+	[[nodiscard]] ColumnVector Scale() const {
+		return this->coMoments.diagonal().cwiseSqrt();
+	}
+
+	[[nodiscard]] const Derived& Self() const {
+		return static_cast<const Derived&>(*this);
+	}
+
+	[[nodiscard]] double Rows() const {
+		return this->Self().GetEffectiveRowCount();
+	}
+
+	[[nodiscard]] double Cols() const {
+		return static_cast<double>(this->coMoments.cols());
+	}
+};
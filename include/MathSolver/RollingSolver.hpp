@@ -0,0 +1,59 @@
+#pragma once
+#include "IncrementalSolver.hpp"
+
+#include <span>
+#include <stdexcept>
+#include <utility>
+
+template <int P = Dynamic>
+class RollingSolver {
+public:
+	using DataMatrix	= typename IncrementalSolver<P>::DataMatrix;
+	using DataMap		= Eigen::Map<const DataMatrix>;
+
+	RollingSolver() = delete;
+
+	explicit RollingSolver(std::span<const double> data, const Eigen::Index rows, const Eigen::Index columnCount,
+		const Eigen::Index window, const Eigen::Index step)
+		: xMatrix(data.data(), rows, columnCount), window(window), step(step), solver(columnCount) {
+		if (window <= 0 || step <= 0) {
+			throw std::invalid_argument("RollingSolver: window and step must be positive");
+		}
+	}
+
+	[[nodiscard]] Eigen::Index GetWindowCount() const {
+		return this->xMatrix.rows() < this->window ? 0 : (this->xMatrix.rows() - this->window) / this->step + 1;
+	}
+
+	template <class Callback>
+	void Run(Callback&& onWindow) {
+		const auto windowCount = this->GetWindowCount();
+
+		for (auto index = Eigen::Index{}; index < windowCount; ++index) {
+			const auto begin = index * this->step;
+
+			if (index == 0 || this->step >= this->window) {
+				this->Reload(begin);
+			}
+			else {
+				this->solver.AppendRows(this->xMatrix.middleRows(begin + this->window - this->step, this->step));
+				this->solver.RemoveRows(this->xMatrix.middleRows(begin - this->step, this->step));
+			}
+
+			onWindow(begin, std::as_const(this->solver));
+		}
+	}
+
+private:
+	DataMap xMatrix;
+	Eigen::Index window;
+	Eigen::Index step;
+	IncrementalSolver<P> solver;
+
+	void Reload(const Eigen::Index begin) {
+		Moments<P> moments(this->xMatrix.cols());
+		moments.Update(this->xMatrix.middleRows(begin, this->window));
+
+		this->solver = IncrementalSolver<P>(moments);
+	}
+};
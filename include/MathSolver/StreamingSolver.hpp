@@ -0,0 +1,99 @@
+#pragma once
+#include "CorrelationAnalysis.hpp"
+#include "Moments.hpp"
+
+#include <span>
+
+template <int P = Dynamic>
+class StreamingSolver : public CorrelationAnalysis<StreamingSolver<P>, P> {
+public:
+	using DataMatrix	= typename Moments<P>::DataMatrix;
+	using SquareMatrix	= typename CorrelationAnalysis<StreamingSolver<P>, P>::SquareMatrix;
+	using ColumnVector	= typename CorrelationAnalysis<StreamingSolver<P>, P>::ColumnVector;
+	using RowVector		= typename CorrelationAnalysis<StreamingSolver<P>, P>::RowVector;
+
+	StreamingSolver() = delete;
+
+	explicit StreamingSolver(const Eigen::Index columnCount) : moments(columnCount) {
+
+	}
+
+	explicit StreamingSolver(Moments<P> moments) : moments(std::move(moments)) {
+
+	}
+
+	void Update(const Eigen::Ref<const DataMatrix>& chunk) {
+		this->moments.Update(chunk);
+		this->Reset();
+	}
+
+	void UpdateChunked(std::span<const double> data, const Eigen::Index rows, const Eigen::Index chunkRows) {
+		const Eigen::Map<const DataMatrix> matrix(data.data(), rows, this->GetColumnCount());
+
+		for (auto begin = Eigen::Index{}; begin < rows; begin += chunkRows) {
+			this->moments.Update(matrix.middleRows(begin, std::min(chunkRows, rows - begin)));
+		}
+
+		this->Reset();
+	}
+
+	void Merge(const Moments<P>& other) {
+		this->moments.Merge(other);
+		this->Reset();
+	}
+
+	[[nodiscard]] const Moments<P>& GetMoments() const {
+		return this->moments;
+	}
+
+	[[nodiscard]] Eigen::Index GetRowCount() const {
+		return this->moments.GetCount();
+	}
+
+	[[nodiscard]] Eigen::Index GetColumnCount() const {
+		return this->moments.GetColumnCount();
+	}
+
+	[[nodiscard]] double GetSum(const Eigen::Index column) const {
+		return this->moments.GetSums()(column);
+	}
+
+	[[nodiscard]] double GetSquareSum(const Eigen::Index column) const {
+		return this->moments.GetSquareSums()(column);
+	}
+
+	[[nodiscard]] RowVector GetSums() const {
+		return this->moments.GetSums();
+	}
+
+	[[nodiscard]] RowVector GetSquareSums() const {
+		return this->moments.GetSquareSums();
+	}
+
+	[[nodiscard]] double MathExpect(const Eigen::Index column) const {
+		return this->moments.GetMeans()(column);
+	}
+
+	[[nodiscard]] double UnbiasedVarianceEstimate(const Eigen::Index column) const {
+		return this->moments.GetDeviations()(column);
+	}
+
+	[[nodiscard]] const SquareMatrix& CorrelationMatrix() const {
+		if (!this->correlationMatrix.has_value()) {
+			this->correlationMatrix = this->moments.CorrelationMatrix();
+			++this->stageCounters.correlationMatrix;
+		}
+
+		return *this->correlationMatrix;
+	}
+
+private:
+	Moments<P> moments;
+
+	mutable std::optional<SquareMatrix> correlationMatrix;
+
+	void Reset() {
+		this->correlationMatrix.reset();
+		this->ResetAnalysis();
+	}
+};
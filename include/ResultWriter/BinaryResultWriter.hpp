@@ -0,0 +1,68 @@
+#pragma once
+#include "IResultWriter.hpp"
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+static_assert(std::endian::native == std::endian::little, "binary results store little-endian values");
+
+class BinaryResultWriter final : public IResultWriter {
+public:
+	static constexpr std::array<char, 8u> MAGIC{ 'D', 'M', 'L', '5', 'R', 'E', 'S', '\0' };
+	static constexpr std::uint32_t VERSION = 1u;
+
+	void WriteHeader(fmt::memory_buffer& buffer) const override {
+		buffer.append(BinaryResultWriter::MAGIC.data(), BinaryResultWriter::MAGIC.data() + BinaryResultWriter::MAGIC.size());
+		BinaryResultWriter::WriteValue(buffer, BinaryResultWriter::VERSION);
+		BinaryResultWriter::WriteValue(buffer, std::uint32_t{});
+	}
+
+	void WriteRecord(fmt::memory_buffer& buffer, const ResultRecord& record) const override {
+		const auto sizeOffset = buffer.size();
+		BinaryResultWriter::WriteValue(buffer, std::uint64_t{});
+
+		BinaryResultWriter::WriteString(buffer, record.source);
+		BinaryResultWriter::WriteValue(buffer, static_cast<std::uint32_t>(record.columnNames.size()));
+
+		for (const auto& name : record.columnNames) {
+			BinaryResultWriter::WriteString(buffer, name);
+		}
+
+		BinaryResultWriter::WriteValue(buffer, static_cast<std::uint64_t>(record.rowCount));
+		BinaryResultWriter::WriteValue(buffer, record.freedom);
+
+		record.ForEachStatistic([&buffer](const char*, const auto& value) {
+			if constexpr (std::is_same_v<std::decay_t<decltype(value)>, double>) {
+				BinaryResultWriter::WriteValue(buffer, std::uint32_t{ 1u });
+				BinaryResultWriter::WriteValue(buffer, std::uint32_t{ 1u });
+				BinaryResultWriter::WriteValue(buffer, value);
+			}
+			else {
+				BinaryResultWriter::WriteValue(buffer, static_cast<std::uint32_t>(value.rows()));
+				BinaryResultWriter::WriteValue(buffer, static_cast<std::uint32_t>(value.cols()));
+
+				const auto* data = reinterpret_cast<const char*>(value.data());
+				buffer.append(data, data + value.size() * static_cast<Eigen::Index>(sizeof(double)));
+			}
+		});
+
+		const auto recordSize = static_cast<std::uint64_t>(buffer.size() - sizeOffset - sizeof(std::uint64_t));
+		std::memcpy(buffer.data() + sizeOffset, &recordSize, sizeof(recordSize));
+	}
+
+private:
+	template <class Value>
+	static void WriteValue(fmt::memory_buffer& buffer, const Value value) {
+		const auto* data = reinterpret_cast<const char*>(&value);
+		buffer.append(data, data + sizeof(Value));
+	}
+
+	static void WriteString(fmt::memory_buffer& buffer, const std::string_view text) {
+		BinaryResultWriter::WriteValue(buffer, static_cast<std::uint32_t>(text.size()));
+		buffer.append(text.data(), text.data() + text.size());
+	}
+};
@@ -0,0 +1,69 @@
+#pragma once
+#include "IResultWriter.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+class CsvResultWriter final : public IResultWriter {
+public:
+	void WriteHeader(fmt::memory_buffer& buffer) const override {
+		buffer.append(std::string_view("source,statistic,row,column,value\n"));
+	}
+
+	void WriteRecord(fmt::memory_buffer& buffer, const ResultRecord& record) const override {
+		const auto source = CsvResultWriter::Quote(record.source);
+
+		std::vector<std::string> columnNames;
+		columnNames.reserve(record.columnNames.size());
+		std::ranges::transform(record.columnNames, std::back_inserter(columnNames), &CsvResultWriter::Quote);
+
+		fmt::format_to(std::back_inserter(buffer), "{},rowCount,,,{}\n", source, record.rowCount);
+		fmt::format_to(std::back_inserter(buffer), "{},freedom,,,{}\n", source, record.freedom);
+
+		record.ForEachStatistic([&buffer, &source, &columnNames](const char* name, const auto& value) {
+			using Value = std::decay_t<decltype(value)>;
+
+			if constexpr (std::is_same_v<Value, double>) {
+				fmt::format_to(std::back_inserter(buffer), "{},{},,,{}\n", source, name, value);
+			}
+			else if constexpr (Value::ColsAtCompileTime == 1) {
+				for (auto i = Eigen::Index{}; i < value.size(); ++i) {
+					fmt::format_to(std::back_inserter(buffer), "{},{},{},,{}\n", source, name, columnNames[static_cast<std::size_t>(i)], value(i));
+				}
+			}
+			else {
+				for (auto i = Eigen::Index{}; i < value.rows(); ++i) {
+					for (auto j = Eigen::Index{}; j < value.cols(); ++j) {
+						fmt::format_to(std::back_inserter(buffer), "{},{},{},{},{}\n", source, name,
+							columnNames[static_cast<std::size_t>(i)], columnNames[static_cast<std::size_t>(j)], value(i, j));
+					}
+				}
+			}
+		});
+	}
+
+private:
+	[[nodiscard]] static std::string Quote(const std::string& text) {
+		if (text.find_first_of(",\"\r\n") == std::string::npos) {
+			return text;
+		}
+
+		std::string result("\"");
+
+		for (const auto symbol : text) {
+			if (symbol == '"') {
+				result.push_back('"');
+			}
+
+			result.push_back(symbol);
+		}
+
+		result.push_back('"');
+
+		return result;
+	}
+};
@@ -0,0 +1,13 @@
+#pragma once
+#include "ResultRecord.hpp"
+
+#include "fmt/format.h"
+
+struct IResultWriter {
+public:
+	virtual ~IResultWriter() = default;
+
+	virtual void WriteHeader(fmt::memory_buffer& buffer) const = 0;
+
+	virtual void WriteRecord(fmt::memory_buffer& buffer, const ResultRecord& record) const = 0;
+};
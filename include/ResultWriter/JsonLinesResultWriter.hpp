@@ -0,0 +1,169 @@
+#pragma once
+#include "IResultWriter.hpp"
+
+#include <array>
+#include <cmath>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+
+class JsonLinesResultWriter final : public IResultWriter {
+private:
+	static constexpr std::array<char16_t, 64u> CP1251_UPPER_HALF{
+		0x0402, 0x0403, 0x201A, 0x0453, 0x201E, 0x2026, 0x2020, 0x2021,
+		0x20AC, 0x2030, 0x0409, 0x2039, 0x040A, 0x040C, 0x040B, 0x040F,
+		0x0452, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+		0xFFFD, 0x2122, 0x0459, 0x203A, 0x045A, 0x045C, 0x045B, 0x045F,
+		0x00A0, 0x040E, 0x045E, 0x0408, 0x00A4, 0x0490, 0x00A6, 0x00A7,
+		0x0401, 0x00A9, 0x0404, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x0407,
+		0x00B0, 0x00B1, 0x0406, 0x0456, 0x0491, 0x00B5, 0x00B6, 0x00B7,
+		0x0451, 0x2116, 0x0454, 0x00BB, 0x0458, 0x0405, 0x0455, 0x0457
+	};
+
+public:
+	void WriteHeader(fmt::memory_buffer&) const override {
+
+	}
+
+	void WriteRecord(fmt::memory_buffer& buffer, const ResultRecord& record) const override {
+		buffer.append(std::string_view("{\"source\":"));
+		JsonLinesResultWriter::WriteString(buffer, record.source);
+
+		buffer.append(std::string_view(",\"columns\":["));
+
+		for (auto i = std::size_t{}; i < record.columnNames.size(); ++i) {
+			if (i != 0u) {
+				buffer.push_back(',');
+			}
+
+			JsonLinesResultWriter::WriteString(buffer, record.columnNames[i]);
+		}
+
+		fmt::format_to(std::back_inserter(buffer), "],\"rowCount\":{},\"freedom\":", record.rowCount);
+		JsonLinesResultWriter::WriteNumber(buffer, record.freedom);
+
+		record.ForEachStatistic([&buffer](const char* name, const auto& value) {
+			using Value = std::decay_t<decltype(value)>;
+
+			fmt::format_to(std::back_inserter(buffer), ",\"{}\":", name);
+
+			if constexpr (std::is_same_v<Value, double>) {
+				JsonLinesResultWriter::WriteNumber(buffer, value);
+			}
+			else if (value.size() == 0) {
+				buffer.append(std::string_view("null"));
+			}
+			else if constexpr (Value::ColsAtCompileTime == 1) {
+				JsonLinesResultWriter::WriteArray(buffer, value);
+			}
+			else {
+				buffer.push_back('[');
+
+				for (auto i = Eigen::Index{}; i < value.rows(); ++i) {
+					if (i != 0) {
+						buffer.push_back(',');
+					}
+
+					JsonLinesResultWriter::WriteArray(buffer, value.row(i));
+				}
+
+				buffer.push_back(']');
+			}
+		});
+
+		buffer.append(std::string_view("}\n"));
+	}
+
+private:
+	template <class Vector>
+	static void WriteArray(fmt::memory_buffer& buffer, const Eigen::DenseBase<Vector>& vector) {
+		buffer.push_back('[');
+
+		for (auto i = Eigen::Index{}; i < vector.size(); ++i) {
+			if (i != 0) {
+				buffer.push_back(',');
+			}
+
+			JsonLinesResultWriter::WriteNumber(buffer, vector(i));
+		}
+
+		buffer.push_back(']');
+	}
+
+	static void WriteNumber(fmt::memory_buffer& buffer, const double value) {
+		if (std::isfinite(value)) {
+			fmt::format_to(std::back_inserter(buffer), "{}", value);
+		}
+		else {
+			buffer.append(std::string_view("null"));
+		}
+	}
+
+	static void WriteString(fmt::memory_buffer& buffer, const std::string_view text) {
+		buffer.push_back('"');
+
+		const auto isUtf8 = JsonLinesResultWriter::IsUtf8(text);
+
+		for (const auto symbol : text) {
+			switch (symbol) {
+			case '"':
+				buffer.append(std::string_view("\\\""));
+				break;
+			case '\\':
+				buffer.append(std::string_view("\\\\"));
+				break;
+			case '\n':
+				buffer.append(std::string_view("\\n"));
+				break;
+			case '\r':
+				buffer.append(std::string_view("\\r"));
+				break;
+			case '\t':
+				buffer.append(std::string_view("\\t"));
+				break;
+			default:
+				if (const auto code = static_cast<unsigned char>(symbol); code < 0x20u) {
+					fmt::format_to(std::back_inserter(buffer), "\\u{:04x}", static_cast<unsigned>(code));
+				}
+				else if (code >= 0x80u && !isUtf8) {
+					fmt::format_to(std::back_inserter(buffer), "\\u{:04x}", static_cast<unsigned>(JsonLinesResultWriter::DecodeCp1251(code)));
+				}
+				else {
+					buffer.push_back(symbol);
+				}
+				break;
+			}
+		}
+
+		buffer.push_back('"');
+	}
+
+	[[nodiscard]] static char16_t DecodeCp1251(const unsigned char code) {
+		if (code >= 0xC0u) {
+			return static_cast<char16_t>(0x0410u + (code - 0xC0u));
+		}
+
+		return JsonLinesResultWriter::CP1251_UPPER_HALF[code - 0x80u];
+	}
+
+	[[nodiscard]] static bool IsUtf8(const std::string_view text) {
+		for (auto i = std::size_t{}; i < text.size();) {
+			const auto lead = static_cast<unsigned char>(text[i]);
+			const auto length = lead < 0x80u ? 1u : lead >= 0xC2u && lead < 0xE0u ? 2u : lead >= 0xE0u && lead < 0xF0u ? 3u : lead >= 0xF0u && lead < 0xF5u ? 4u : 0u;
+
+			if (length == 0u || i + length > text.size()) {
+				return false;
+			}
+
+			for (auto j = 1u; j < length; ++j) {
+				if ((static_cast<unsigned char>(text[i + j]) & 0xC0u) != 0x80u) {
+					return false;
+				}
+			}
+
+			i += length;
+		}
+
+		return true;
+	}
+};
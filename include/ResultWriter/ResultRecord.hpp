@@ -0,0 +1,47 @@
+#pragma once
+#include <limits>
+#include <string>
+#include <vector>
+#include <Eigen/Dense>
+
+struct ResultRecord {
+	std::string source;
+	std::vector<std::string> columnNames;
+	Eigen::Index rowCount{};
+	double freedom{};
+
+	Eigen::VectorXd sums;
+	Eigen::VectorXd squareSums;
+	Eigen::MatrixXd correlation;
+	double determinant{};
+	double xi{};
+	double xiCritical{};
+	Eigen::MatrixXd cMatrix;
+	Eigen::VectorXd fStatistics;
+	double fCritical = std::numeric_limits<double>::quiet_NaN();
+	Eigen::VectorXd determination;
+	Eigen::MatrixXd partialCorrelation;
+	Eigen::MatrixXd tCriteria;
+	double tCritical = std::numeric_limits<double>::quiet_NaN();
+	Eigen::MatrixXd pValues;
+	double significantCount = std::numeric_limits<double>::quiet_NaN();
+
+	template <class Visitor>
+	void ForEachStatistic(Visitor&& visitor) const {
+		visitor("sums", this->sums);
+		visitor("squareSums", this->squareSums);
+		visitor("correlation", this->correlation);
+		visitor("determinant", this->determinant);
+		visitor("xi", this->xi);
+		visitor("xiCritical", this->xiCritical);
+		visitor("cMatrix", this->cMatrix);
+		visitor("fStatistics", this->fStatistics);
+		visitor("fCritical", this->fCritical);
+		visitor("determination", this->determination);
+		visitor("partialCorrelation", this->partialCorrelation);
+		visitor("tCriteria", this->tCriteria);
+		visitor("tCritical", this->tCritical);
+		visitor("pValues", this->pValues);
+		visitor("significantCount", this->significantCount);
+	}
+};
@@ -0,0 +1,99 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+
+template <class T>
+class BoundedQueue {
+public:
+	struct Statistics {
+		std::size_t pushCount{};
+		std::size_t depthSum{};
+		std::size_t maxDepth{};
+		std::chrono::nanoseconds fullWait{};
+		std::chrono::nanoseconds emptyWait{};
+	};
+
+	BoundedQueue() = delete;
+
+	BoundedQueue(const BoundedQueue&) = delete;
+
+	explicit BoundedQueue(const std::size_t capacity) : capacity(std::max<std::size_t>(1u, capacity)) {
+
+	}
+
+	bool Push(T value) {
+		std::unique_lock lock(this->mutex);
+
+		const auto waitBegin = std::chrono::steady_clock::now();
+		this->notFull.wait(lock, [this] { return this->isClosed || this->items.size() < this->capacity; });
+		this->statistics.fullWait += std::chrono::steady_clock::now() - waitBegin;
+
+		if (this->isClosed) {
+			return false;
+		}
+
+		this->items.push_back(std::move(value));
+
+		++this->statistics.pushCount;
+		this->statistics.depthSum += this->items.size();
+		this->statistics.maxDepth = std::max(this->statistics.maxDepth, this->items.size());
+
+		lock.unlock();
+		this->notEmpty.notify_one();
+
+		return true;
+	}
+
+	[[nodiscard]] std::optional<T> Pop() {
+		std::unique_lock lock(this->mutex);
+
+		const auto waitBegin = std::chrono::steady_clock::now();
+		this->notEmpty.wait(lock, [this] { return this->isClosed || !this->items.empty(); });
+		this->statistics.emptyWait += std::chrono::steady_clock::now() - waitBegin;
+
+		if (this->items.empty()) {
+			return std::nullopt;
+		}
+
+		auto value = std::move(this->items.front());
+		this->items.pop_front();
+
+		lock.unlock();
+		this->notFull.notify_one();
+
+		return value;
+	}
+
+	void Close() {
+		{
+			const std::lock_guard lock(this->mutex);
+			this->isClosed = true;
+		}
+
+		this->notFull.notify_all();
+		this->notEmpty.notify_all();
+	}
+
+	[[nodiscard]] std::size_t GetCapacity() const {
+		return this->capacity;
+	}
+
+	[[nodiscard]] Statistics GetStatistics() const {
+		const std::lock_guard lock(this->mutex);
+		return this->statistics;
+	}
+
+private:
+	std::size_t capacity;
+	std::deque<T> items;
+	Statistics statistics{};
+	bool isClosed{};
+
+	mutable std::mutex mutex;
+	std::condition_variable notFull;
+	std::condition_variable notEmpty;
+};
@@ -0,0 +1,120 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+class WorkStealingPool {
+public:
+	WorkStealingPool() = delete;
+
+	WorkStealingPool(const WorkStealingPool&) = delete;
+
+	explicit WorkStealingPool(const unsigned threadCount) {
+		const auto count = std::max(1u, threadCount);
+
+		for (auto i = 0u; i < count; ++i) {
+			this->queues.push_back(std::make_unique<Queue>());
+		}
+		for (auto i = 0u; i < count; ++i) {
+			this->threads.emplace_back([this, i] { this->Work(i); });
+		}
+	}
+
+	~WorkStealingPool() {
+		{
+			const std::lock_guard lock(this->sleepMutex);
+			this->isStopping = true;
+		}
+
+		this->sleepCondition.notify_all();
+		std::ranges::for_each(this->threads, [](auto& thread) { thread.join(); });
+	}
+
+	[[nodiscard]] unsigned GetThreadCount() const {
+		return static_cast<unsigned>(this->threads.size());
+	}
+
+	template <class Task>
+	[[nodiscard]] std::future<std::invoke_result_t<Task>> Submit(Task&& task) {
+		auto packagedTask = std::make_shared<std::packaged_task<std::invoke_result_t<Task>()>>(std::forward<Task>(task));
+		auto future = packagedTask->get_future();
+
+		auto& queue = *this->queues[this->nextQueue++ % this->queues.size()];
+		{
+			const std::lock_guard lock(this->sleepMutex);
+			++this->pendingCount;
+		}
+		{
+			const std::lock_guard lock(queue.mutex);
+			queue.tasks.emplace_back([packagedTask] { (*packagedTask)(); });
+		}
+
+		this->sleepCondition.notify_one();
+		return future;
+	}
+
+private:
+	struct Queue {
+		std::mutex mutex;
+		std::deque<std::function<void()>> tasks;
+	};
+
+	std::vector<std::unique_ptr<Queue>> queues;
+	std::vector<std::thread> threads;
+	std::atomic<std::size_t> nextQueue{};
+	std::atomic<std::size_t> pendingCount{};
+	std::mutex sleepMutex;
+	std::condition_variable sleepCondition;
+	bool isStopping{};
+
+	void Work(const std::size_t index) {
+		while (true) {
+			std::function<void()> task;
+
+			if (this->TryPop(index, task)) {
+				task();
+				continue;
+			}
+
+			std::unique_lock lock(this->sleepMutex);
+			this->sleepCondition.wait(lock, [this] { return this->isStopping || this->pendingCount > 0u; });
+
+			if (this->isStopping && this->pendingCount == 0u) {
+				return;
+			}
+		}
+	}
+
+	[[nodiscard]] bool TryPop(const std::size_t index, std::function<void()>& task) {
+		for (auto offset = std::size_t{}; offset < this->queues.size(); ++offset) {
+			auto& queue = *this->queues[(index + offset) % this->queues.size()];
+			const std::lock_guard lock(queue.mutex);
+
+			if (queue.tasks.empty()) {
+				continue;
+			}
+
+			if (offset == 0u) {
+				task = std::move(queue.tasks.front());
+				queue.tasks.pop_front();
+			}
+			else {
+				task = std::move(queue.tasks.back());
+				queue.tasks.pop_back();
+			}
+
+			--this->pendingCount;
+			return true;
+		}
+
+		return false;
+	}
+};
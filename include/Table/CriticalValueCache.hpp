@@ -0,0 +1,140 @@
+#pragma once
+#include "SpecialFunctions.hpp"
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+
+class CriticalValueCache {
+public:
+	enum class Distribution : std::uint32_t {
+		CHI_SQUARE,
+		FISHER,
+		STUDENT
+	};
+
+	struct Key {
+		Distribution distribution;
+		double k1;
+		double k2;
+		double alpha;
+
+		[[nodiscard]] bool operator==(const Key&) const = default;
+	};
+
+	struct Counters {
+		std::uint64_t hits;
+		std::uint64_t misses;
+	};
+
+	static constexpr std::size_t CAPACITY = 1024u;
+
+	CriticalValueCache(const CriticalValueCache&) = delete;
+
+	~CriticalValueCache() = default;
+
+	static CriticalValueCache& GetInstance() {
+		static CriticalValueCache instance;
+		return instance;
+	}
+
+	[[nodiscard]] double Get(const Key& key) {
+		const auto hash = CriticalValueCache::Hash(key);
+
+		for (auto probe = std::size_t{}; probe < CriticalValueCache::CAPACITY; ++probe) {
+			auto& slot = this->slots[(hash + probe) % CriticalValueCache::CAPACITY];
+			const auto state = slot.state.load(std::memory_order_acquire);
+
+			if (state == SlotState::EMPTY) {
+				break;
+			}
+			if (state == SlotState::READY && slot.key == key) {
+				this->hits.fetch_add(1u, std::memory_order_relaxed);
+				return slot.value;
+			}
+		}
+
+		this->misses.fetch_add(1u, std::memory_order_relaxed);
+
+		const auto value = CriticalValueCache::Compute(key);
+		this->Insert(key, hash, value);
+
+		return value;
+	}
+
+	void WarmUp(std::span<const Key> keys) {
+		for (const auto& key : keys) {
+			static_cast<void>(this->Get(key));
+		}
+	}
+
+	[[nodiscard]] Counters GetCounters() const {
+		return Counters{ this->hits.load(std::memory_order_relaxed), this->misses.load(std::memory_order_relaxed) };
+	}
+
+	[[nodiscard]] static double Compute(const Key& key) {
+		switch (key.distribution) {
+		case Distribution::CHI_SQUARE:
+			return SpecialFunctions::ChiSquareUpperQuantile(key.k1, key.alpha);
+		case Distribution::FISHER:
+			return SpecialFunctions::FisherUpperQuantile(key.k1, key.k2, key.alpha);
+		case Distribution::STUDENT:
+			return SpecialFunctions::StudentTwoSidedQuantile(key.k1, key.alpha);
+		}
+
+		throw std::invalid_argument("CriticalValueCache: unknown distribution");
+	}
+
+private:
+	enum SlotState : std::uint32_t {
+		EMPTY,
+		WRITING,
+		READY
+	};
+
+	struct Slot {
+		std::atomic<std::uint32_t> state{ SlotState::EMPTY };
+		Key key{};
+		double value{};
+	};
+
+	std::array<Slot, CriticalValueCache::CAPACITY> slots{};
+	std::atomic<std::uint64_t> hits{};
+	std::atomic<std::uint64_t> misses{};
+
+	CriticalValueCache() = default;
+
+	void Insert(const Key& key, const std::size_t hash, const double value) {
+		for (auto probe = std::size_t{}; probe < CriticalValueCache::CAPACITY; ++probe) {
+			auto& slot = this->slots[(hash + probe) % CriticalValueCache::CAPACITY];
+			auto expected = static_cast<std::uint32_t>(SlotState::EMPTY);
+
+			if (slot.state.compare_exchange_strong(expected, SlotState::WRITING, std::memory_order_acquire)) {
+				slot.key = key;
+				slot.value = value;
+				slot.state.store(SlotState::READY, std::memory_order_release);
+				return;
+			}
+			if (expected == SlotState::READY && slot.key == key) {
+				return;
+			}
+		}
+	}
+
+	[[nodiscard]] static std::size_t Hash(const Key& key) {
+		auto hash = static_cast<std::uint64_t>(key.distribution);
+
+		for (const auto value : { key.k1, key.k2, key.alpha }) {
+			hash ^= std::bit_cast<std::uint64_t>(value) + 0x9E3779B97F4A7C15ull + (hash << 6u) + (hash >> 2u);
+		}
+
+		hash ^= hash >> 33u;
+		hash *= 0xFF51AFD7ED558CCDull;
+		hash ^= hash >> 33u;
+
+		return static_cast<std::size_t>(hash);
+	}
+};
@@ -0,0 +1,140 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+class MultipleTesting {
+private:
+	static constexpr auto RADIX_BITS = 11u;
+	static constexpr auto RADIX_SIZE = std::size_t{ 1u } << MultipleTesting::RADIX_BITS;
+	static constexpr auto RADIX_PASSES = (64u + MultipleTesting::RADIX_BITS - 1u) / MultipleTesting::RADIX_BITS;
+
+public:
+	enum class Adjustment {
+		NONE,
+		HOLM,
+		BENJAMINI_HOCHBERG
+	};
+
+	MultipleTesting() = delete;
+
+	static void Adjust(std::span<double> pValues, const Adjustment adjustment) {
+		switch (adjustment) {
+		case Adjustment::NONE:
+			return;
+		case Adjustment::HOLM:
+			MultipleTesting::Holm(pValues);
+			return;
+		case Adjustment::BENJAMINI_HOCHBERG:
+			MultipleTesting::BenjaminiHochberg(pValues);
+			return;
+		}
+	}
+
+	static void Holm(std::span<double> pValues) {
+		auto sorted = MultipleTesting::Sort(pValues);
+		const auto count = static_cast<double>(sorted.order.size());
+		auto running = 0.0;
+
+		for (auto rank = std::size_t{}; rank < sorted.order.size(); ++rank) {
+			running = std::max(running, std::min(1.0, (count - static_cast<double>(rank)) * sorted.values[rank]));
+			sorted.values[rank] = running;
+		}
+
+		MultipleTesting::Scatter(sorted, pValues);
+	}
+
+	static void BenjaminiHochberg(std::span<double> pValues) {
+		auto sorted = MultipleTesting::Sort(pValues);
+		const auto count = static_cast<double>(sorted.order.size());
+		auto running = 1.0;
+
+		for (auto rank = sorted.order.size(); rank-- > 0u;) {
+			running = std::min(running, count / static_cast<double>(rank + 1u) * sorted.values[rank]);
+			sorted.values[rank] = running;
+		}
+
+		MultipleTesting::Scatter(sorted, pValues);
+	}
+
+private:
+	struct Sorted {
+		std::vector<double> values;
+		std::vector<std::uint32_t> order;
+	};
+
+	[[nodiscard]] static Sorted Sort(std::span<const double> values) {
+		if (values.size() > std::numeric_limits<std::uint32_t>::max()) {
+			throw std::length_error("MultipleTesting: too many p-values");
+		}
+
+		std::vector<std::uint32_t> order;
+		std::vector<std::uint64_t> keys;
+		order.reserve(values.size());
+		keys.reserve(values.size());
+
+		std::array<std::vector<std::size_t>, MultipleTesting::RADIX_PASSES> offsets;
+		std::ranges::fill(offsets, std::vector<std::size_t>(MultipleTesting::RADIX_SIZE));
+
+		for (auto i = std::size_t{}; i < values.size(); ++i) {
+			if (!std::isnan(values[i])) {
+				const auto key = std::bit_cast<std::uint64_t>(std::max(values[i], 0.0) + 0.0);
+
+				for (auto pass = 0u; pass < MultipleTesting::RADIX_PASSES; ++pass) {
+					++offsets[pass][MultipleTesting::Digit(key, pass)];
+				}
+
+				order.push_back(static_cast<std::uint32_t>(i));
+				keys.push_back(key);
+			}
+		}
+
+		std::vector<std::uint32_t> orderBuffer(order.size());
+		std::vector<std::uint64_t> keyBuffer(keys.size());
+
+		for (auto pass = 0u; pass < MultipleTesting::RADIX_PASSES; ++pass) {
+			auto& passOffsets = offsets[pass];
+
+			if (std::ranges::find(passOffsets, keys.size()) != passOffsets.end()) {
+				continue;
+			}
+
+			auto total = std::size_t{};
+
+			for (auto& offset : passOffsets) {
+				total += std::exchange(offset, total);
+			}
+
+			for (auto i = std::size_t{}; i < keys.size(); ++i) {
+				const auto position = passOffsets[MultipleTesting::Digit(keys[i], pass)]++;
+				keyBuffer[position] = keys[i];
+				orderBuffer[position] = order[i];
+			}
+
+			keys.swap(keyBuffer);
+			order.swap(orderBuffer);
+		}
+
+		Sorted sorted{ std::vector<double>(keys.size()), std::move(order) };
+		std::ranges::transform(keys, sorted.values.begin(), [](const auto key) { return std::bit_cast<double>(key); });
+
+		return sorted;
+	}
+
+	[[nodiscard]] static std::size_t Digit(const std::uint64_t key, const unsigned pass) {
+		return static_cast<std::size_t>(key >> (pass * MultipleTesting::RADIX_BITS)) & (MultipleTesting::RADIX_SIZE - 1u);
+	}
+
+	static void Scatter(const Sorted& sorted, std::span<double> pValues) {
+		for (auto rank = std::size_t{}; rank < sorted.order.size(); ++rank) {
+			pValues[sorted.order[rank]] = sorted.values[rank];
+		}
+	}
+};
@@ -0,0 +1,279 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <math.h>
+#include <limits>
+#include <numbers>
+#include <stdexcept>
+
+class SpecialFunctions {
+private:
+	static constexpr auto EPSILON = 1e-15;
+	static constexpr auto TINY = 1e-300;
+	static constexpr auto MAX_ITERATIONS = 100000u;
+	static constexpr auto MAX_ROOT_ITERATIONS = 200u;
+
+public:
+	SpecialFunctions() = delete;
+
+	[[nodiscard]] static double RegularizedGammaP(const double a, const double x) {
+		SpecialFunctions::CheckGammaArguments(a, x);
+
+		if (x == 0.0) {
+			return 0.0;
+		}
+
+		return x < a + 1.0 ? SpecialFunctions::GammaSeries(a, x) : 1.0 - SpecialFunctions::GammaContinuedFraction(a, x);
+	}
+
+	[[nodiscard]] static double RegularizedGammaQ(const double a, const double x) {
+		SpecialFunctions::CheckGammaArguments(a, x);
+
+		if (x == 0.0) {
+			return 1.0;
+		}
+
+		return x < a + 1.0 ? 1.0 - SpecialFunctions::GammaSeries(a, x) : SpecialFunctions::GammaContinuedFraction(a, x);
+	}
+
+	[[nodiscard]] static double InverseRegularizedGammaQ(const double a, const double q) {
+		if (!(a > 0.0) || !(q > 0.0) || !(q < 1.0)) {
+			throw std::invalid_argument("SpecialFunctions: the gamma quantile needs a > 0 and 0 < q < 1");
+		}
+
+		auto low = 0.0;
+		auto high = std::max(1.0, 2.0 * a);
+
+		while (SpecialFunctions::RegularizedGammaQ(a, high) > q) {
+			low = high;
+			high *= 2.0;
+		}
+
+		auto x = std::clamp(SpecialFunctions::WilsonHilferty(a, q), low, high);
+		const auto logGamma = SpecialFunctions::LogGamma(a);
+
+		for (auto i = 0u; i < SpecialFunctions::MAX_ROOT_ITERATIONS; ++i) {
+			const auto error = SpecialFunctions::RegularizedGammaQ(a, x) - q;
+
+			if (error > 0.0) {
+				low = x;
+			}
+			else {
+				high = x;
+			}
+
+			const auto density = std::exp((a - 1.0) * std::log(x) - x - logGamma);
+			auto next = density > 0.0 ? x + error / density : 0.5 * (low + high);
+
+			if (!(next > low && next < high)) {
+				next = 0.5 * (low + high);
+			}
+
+			if (std::abs(next - x) <= SpecialFunctions::EPSILON * 10.0 * std::max(1.0, x) || high - low <= SpecialFunctions::EPSILON * high) {
+				return next;
+			}
+
+			x = next;
+		}
+
+		return x;
+	}
+
+	[[nodiscard]] static double RegularizedBeta(const double a, const double b, const double x) {
+		if (!(a > 0.0) || !(b > 0.0) || !(x >= 0.0) || !(x <= 1.0)) {
+			throw std::invalid_argument("SpecialFunctions: the incomplete beta function needs a, b > 0 and 0 <= x <= 1");
+		}
+
+		return SpecialFunctions::RegularizedBeta(a, b, x, SpecialFunctions::LogBeta(a, b));
+	}
+
+	[[nodiscard]] static double RegularizedBeta(const double a, const double b, const double x, const double logBeta) {
+		if (x <= 0.0 || x >= 1.0) {
+			return x <= 0.0 ? 0.0 : 1.0;
+		}
+
+		return x < (a + 1.0) / (a + b + 2.0)
+			? SpecialFunctions::BetaPrefactor(a, b, x, logBeta) * SpecialFunctions::BetaContinuedFraction(a, b, x) / a
+			: 1.0 - SpecialFunctions::BetaPrefactor(a, b, x, logBeta) * SpecialFunctions::BetaContinuedFraction(b, a, 1.0 - x) / b;
+	}
+
+	[[nodiscard]] static double LogBeta(const double a, const double b) {
+		return SpecialFunctions::LogGamma(a) + SpecialFunctions::LogGamma(b) - SpecialFunctions::LogGamma(a + b);
+	}
+
+	[[nodiscard]] static double InverseRegularizedBeta(const double a, const double b, const double p) {
+		if (!(a > 0.0) || !(b > 0.0) || !(p > 0.0) || !(p < 1.0)) {
+			throw std::invalid_argument("SpecialFunctions: the beta quantile needs a, b > 0 and 0 < p < 1");
+		}
+
+		auto low = 0.0;
+		auto high = 1.0;
+		auto x = a / (a + b);
+		const auto logBeta = SpecialFunctions::LogBeta(a, b);
+
+		for (auto i = 0u; i < SpecialFunctions::MAX_ROOT_ITERATIONS; ++i) {
+			const auto error = SpecialFunctions::RegularizedBeta(a, b, x, logBeta) - p;
+
+			if (error < 0.0) {
+				low = x;
+			}
+			else {
+				high = x;
+			}
+
+			const auto density = std::exp((a - 1.0) * std::log(x) + (b - 1.0) * std::log1p(-x) - logBeta);
+			auto next = density > 0.0 && std::isfinite(density) ? x - error / density : 0.5 * (low + high);
+
+			if (!(next > low && next < high)) {
+				next = 0.5 * (low + high);
+			}
+
+			if (std::abs(next - x) <= SpecialFunctions::EPSILON * 10.0 * x || high - low <= SpecialFunctions::EPSILON * high) {
+				return next;
+			}
+
+			x = next;
+		}
+
+		return x;
+	}
+
+	[[nodiscard]] static double ChiSquareUpperQuantile(const double k, const double alpha) {
+		return 2.0 * SpecialFunctions::InverseRegularizedGammaQ(0.5 * k, alpha);
+	}
+
+	[[nodiscard]] static double FisherUpperQuantile(const double k1, const double k2, const double alpha) {
+		const auto tail = SpecialFunctions::InverseRegularizedBeta(0.5 * k2, 0.5 * k1, alpha);
+		return k2 * (1.0 - tail) / (k1 * tail);
+	}
+
+	[[nodiscard]] static double StudentTwoSidedQuantile(const double k, const double alpha) {
+		const auto x = SpecialFunctions::InverseRegularizedBeta(0.5 * k, 0.5, alpha);
+		return std::sqrt(k * (1.0 - x) / x);
+	}
+
+	[[nodiscard]] static double NormalUpperQuantile(const double q) {
+		return std::numbers::sqrt2 * SpecialFunctions::InverseErfc(2.0 * q);
+	}
+
+	[[nodiscard]] static double InverseErfc(const double y) {
+		if (!(y > 0.0) || !(y < 2.0)) {
+			throw std::invalid_argument("SpecialFunctions: erfc^-1 needs 0 < y < 2");
+		}
+
+		const auto p = y < 1.0 ? y : 2.0 - y;
+		const auto t = std::sqrt(-2.0 * std::log(p / 2.0));
+		auto x = -0.70711 * ((2.30753 + t * 0.27061) / (1.0 + t * (0.99229 + t * 0.04481)) - t);
+
+		for (auto i = 0u; i < 3u; ++i) {
+			const auto error = std::erfc(x) - p;
+			x += error / (2.0 / std::sqrt(std::numbers::pi) * std::exp(-x * x) - x * error);
+		}
+
+		return y < 1.0 ? x : -x;
+	}
+
+private:
+	[[nodiscard]] static double LogGamma(const double x) {
+		#if defined(_WIN32)
+			return std::lgamma(x);
+		#else
+			auto sign = 0;
+			return lgamma_r(x, &sign);
+		#endif
+	}
+
+	static void CheckGammaArguments(const double a, const double x) {
+		if (!(a > 0.0) || !(x >= 0.0)) {
+			throw std::invalid_argument("SpecialFunctions: the incomplete gamma function needs a > 0 and x >= 0");
+		}
+	}
+
+	[[nodiscard]] static double GammaPrefactor(const double a, const double x) {
+		return std::exp(a * std::log(x) - x - SpecialFunctions::LogGamma(a));
+	}
+
+	[[nodiscard]] static double GammaSeries(const double a, const double x) {
+		auto denominator = a;
+		auto term = 1.0 / a;
+		auto sum = term;
+
+		for (auto i = 0u; i < SpecialFunctions::MAX_ITERATIONS; ++i) {
+			denominator += 1.0;
+			term *= x / denominator;
+			sum += term;
+
+			if (std::abs(term) < std::abs(sum) * SpecialFunctions::EPSILON) {
+				break;
+			}
+		}
+
+		return sum * SpecialFunctions::GammaPrefactor(a, x);
+	}
+
+	[[nodiscard]] static double GammaContinuedFraction(const double a, const double x) {
+		auto b = x + 1.0 - a;
+		auto c = 1.0 / SpecialFunctions::TINY;
+		auto d = 1.0 / b;
+		auto result = d;
+
+		for (auto i = 1u; i < SpecialFunctions::MAX_ITERATIONS; ++i) {
+			const auto an = -static_cast<double>(i) * (static_cast<double>(i) - a);
+			b += 2.0;
+
+			d = an * d + b;
+			d = std::abs(d) < SpecialFunctions::TINY ? SpecialFunctions::TINY : d;
+			c = b + an / c;
+			c = std::abs(c) < SpecialFunctions::TINY ? SpecialFunctions::TINY : c;
+			d = 1.0 / d;
+
+			const auto delta = d * c;
+			result *= delta;
+
+			if (std::abs(delta - 1.0) < SpecialFunctions::EPSILON) {
+				break;
+			}
+		}
+
+		return result * SpecialFunctions::GammaPrefactor(a, x);
+	}
+
+	[[nodiscard]] static double BetaPrefactor(const double a, const double b, const double x, const double logBeta) {
+		return std::exp(a * std::log(x) + b * std::log1p(-x) - logBeta);
+	}
+
+	[[nodiscard]] static double BetaContinuedFraction(const double a, const double b, const double x) {
+		auto c = 1.0;
+		auto d = 1.0 - (a + b) * x / (a + 1.0);
+		d = std::abs(d) < SpecialFunctions::TINY ? SpecialFunctions::TINY : d;
+		d = 1.0 / d;
+		auto result = d;
+
+		for (auto m = 1u; m < SpecialFunctions::MAX_ITERATIONS; ++m) {
+			const auto m2 = 2.0 * m;
+
+			for (const auto an : { m * (b - m) * x / ((a + m2 - 1.0) * (a + m2)), -(a + m) * (a + b + m) * x / ((a + m2) * (a + m2 + 1.0)) }) {
+				d = 1.0 + an * d;
+				d = std::abs(d) < SpecialFunctions::TINY ? SpecialFunctions::TINY : d;
+				c = 1.0 + an / c;
+				c = std::abs(c) < SpecialFunctions::TINY ? SpecialFunctions::TINY : c;
+				d = 1.0 / d;
+				result *= d * c;
+			}
+
+			if (std::abs(d * c - 1.0) < SpecialFunctions::EPSILON) {
+				break;
+			}
+		}
+
+		return result;
+	}
+
+	[[nodiscard]] static double WilsonHilferty(const double a, const double q) {
+		const auto z = SpecialFunctions::NormalUpperQuantile(q);
+		const auto h = 1.0 / (9.0 * a);
+		const auto root = 1.0 - h + z * std::sqrt(h);
+
+		return root > 0.0 ? a * root * root * root : a * q;
+	}
+};
@@ -0,0 +1,196 @@
+#pragma once
+#include "CriticalValueCache.hpp"
+#include "MultipleTesting.hpp"
+#include "SpecialFunctions.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <Eigen/Dense>
+
+class StudentT {
+private:
+	static constexpr auto TABLE_SIZE = 4096u;
+	static constexpr auto TABLE_THRESHOLD = std::size_t{ 65536u };
+	static constexpr auto TABLE_LOG_P_LIMIT = 600.0;
+
+public:
+	struct TestResult {
+		Eigen::MatrixXd pValues;
+		Eigen::Matrix<bool, Eigen::Dynamic, Eigen::Dynamic> significance;
+		Eigen::Index significantCount;
+	};
+
+	explicit StudentT(double k) : k_(k) {
+		if (!(k > 0.0)) {
+			throw std::invalid_argument("StudentT: the number of degrees of freedom must be positive");
+		}
+
+		this->logBeta_ = SpecialFunctions::LogBeta(0.5 * k, 0.5);
+	}
+
+	[[nodiscard]] double GetTStatistics(double x) const {
+		if (!(x > 0.0) || !(x < 1.0)) {
+			throw std::invalid_argument("StudentT: the significance level must lie in (0, 1)");
+		}
+
+		return CriticalValueCache::GetInstance().Get({ CriticalValueCache::Distribution::STUDENT, this->k_, 0.0, x });
+	}
+
+	[[nodiscard]] double GetPValue(double t) const {
+		if (std::isnan(t)) {
+			return t;
+		}
+
+		return SpecialFunctions::RegularizedBeta(0.5 * this->k_, 0.5, this->k_ / (this->k_ + t * t), this->logBeta_);
+	}
+
+	[[nodiscard]] TestResult Test(const Eigen::Ref<const Eigen::MatrixXd>& tMatrix, const double alpha,
+		const MultipleTesting::Adjustment adjustment, const unsigned threadCount = std::thread::hardware_concurrency()) const {
+		const auto size = tMatrix.cols();
+		const auto pairCount = static_cast<std::size_t>(size * (size - 1) / 2);
+
+		std::vector<double> pValues(pairCount);
+
+		if (pairCount >= StudentT::TABLE_THRESHOLD) {
+			const auto table = this->BuildTable();
+			StudentT::ForEachPair(tMatrix, pValues, threadCount, [this, &table](const double t) { return this->InterpolatePValue(table, t); });
+		}
+		else {
+			StudentT::ForEachPair(tMatrix, pValues, 1u, [this](const double t) { return this->GetPValue(t); });
+		}
+
+		MultipleTesting::Adjust(pValues, adjustment);
+
+		TestResult result{
+			Eigen::MatrixXd::Constant(size, size, std::numeric_limits<double>::quiet_NaN()),
+			Eigen::Matrix<bool, Eigen::Dynamic, Eigen::Dynamic>::Constant(size, size, false),
+			0
+		};
+
+		for (auto j = Eigen::Index{}, pair = Eigen::Index{}; j < size; ++j) {
+			for (auto i = Eigen::Index{}; i < j; ++i, ++pair) {
+				const auto value = pValues[static_cast<std::size_t>(pair)];
+				const auto isSignificant = value <= alpha;
+
+				result.pValues(i, j) = result.pValues(j, i) = value;
+				result.significance(i, j) = result.significance(j, i) = isSignificant;
+				result.significantCount += isSignificant ? 1 : 0;
+			}
+		}
+
+		return result;
+	}
+
+private:
+	struct Table {
+		double step;
+		double limit;
+		std::vector<double> logP;
+		std::vector<double> slope;
+	};
+
+	double k_;
+	double logBeta_{};
+
+	[[nodiscard]] Table BuildTable() const {
+		const auto a = 0.5 * this->k_;
+
+		Table table{};
+		table.limit = std::sqrt(StudentT::TABLE_LOG_P_LIMIT / std::max(a, 1.0));
+		table.step = table.limit / static_cast<double>(StudentT::TABLE_SIZE - 1u);
+		table.logP.resize(StudentT::TABLE_SIZE);
+		table.slope.resize(StudentT::TABLE_SIZE);
+
+		for (auto i = 0u; i < StudentT::TABLE_SIZE; ++i) {
+			const auto q = table.step * static_cast<double>(i);
+			const auto u = std::exp(-q * q);
+			const auto p = SpecialFunctions::RegularizedBeta(a, 0.5, u, this->logBeta_);
+
+			table.logP[i] = std::log(p);
+			table.slope[i] = i == 0u
+				? -2.0 / std::exp(this->logBeta_)
+				: -2.0 * q * std::exp(a * std::log(u) - 0.5 * std::log(-std::expm1(-q * q)) - this->logBeta_) / p;
+		}
+
+		return table;
+	}
+
+	[[nodiscard]] double InterpolatePValue(const Table& table, const double t) const {
+		if (std::isnan(t)) {
+			return t;
+		}
+
+		const auto q = std::sqrt(std::log1p(t * t / this->k_));
+		const auto position = q / table.step;
+
+		if (!(position < static_cast<double>(StudentT::TABLE_SIZE - 1u))) {
+			return this->GetPValue(t);
+		}
+
+		const auto index = static_cast<std::size_t>(position);
+		const auto s = position - static_cast<double>(index);
+		const auto s2 = s * s;
+		const auto s3 = s2 * s;
+
+		const auto logP = (2.0 * s3 - 3.0 * s2 + 1.0) * table.logP[index] + (s3 - 2.0 * s2 + s) * table.step * table.slope[index]
+			+ (-2.0 * s3 + 3.0 * s2) * table.logP[index + 1u] + (s3 - s2) * table.step * table.slope[index + 1u];
+
+		return std::exp(logP);
+	}
+
+	template <class Evaluate>
+	static void ForEachPair(const Eigen::Ref<const Eigen::MatrixXd>& tMatrix, std::vector<double>& pValues, const unsigned threadCount, Evaluate evaluate) {
+		const auto chunkCount = std::max(1u, threadCount);
+		const auto chunkSize = (pValues.size() + chunkCount - 1u) / chunkCount;
+
+		std::vector<std::exception_ptr> errors(chunkCount);
+		std::vector<std::thread> threads;
+
+		const auto run = [&tMatrix, &pValues, &errors, &evaluate, chunkSize](const unsigned chunk) {
+			try {
+				const auto begin = std::min(pValues.size(), chunk * chunkSize);
+				const auto end = std::min(pValues.size(), begin + chunkSize);
+
+				auto j = static_cast<Eigen::Index>((1.0 + std::sqrt(1.0 + 8.0 * static_cast<double>(begin))) / 2.0);
+				while (static_cast<std::size_t>(j * (j - 1) / 2) > begin) {
+					--j;
+				}
+				while (static_cast<std::size_t>((j + 1) * j / 2) <= begin) {
+					++j;
+				}
+
+				auto i = static_cast<Eigen::Index>(begin - static_cast<std::size_t>(j * (j - 1) / 2));
+
+				for (auto pair = begin; pair < end; ++pair) {
+					pValues[pair] = evaluate(tMatrix(i, j));
+
+					if (++i == j) {
+						i = 0;
+						++j;
+					}
+				}
+			}
+			catch (...) {
+				errors[chunk] = std::current_exception();
+			}
+		};
+
+		for (auto chunk = 1u; chunk < chunkCount; ++chunk) {
+			threads.emplace_back(run, chunk);
+		}
+
+		run(0u);
+		std::ranges::for_each(threads, [](auto& thread) { thread.join(); });
+
+		for (const auto& error : errors) {
+			if (error) {
+				std::rethrow_exception(error);
+			}
+		}
+	}
+};